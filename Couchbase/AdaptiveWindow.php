@@ -0,0 +1,115 @@
+<?php
+
+/**
+ * Copyright 2014-Present Couchbase, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+declare(strict_types=1);
+
+namespace Couchbase;
+
+use Couchbase\Exception\TimeoutException;
+
+/**
+ * Splits large multi-operations into windows, whose size is adjusted using additive increase/multiplicative
+ * decrease: the window is halved after a window with timed out operations, and grows back towards the limit
+ * after every window completed without timeouts.
+ *
+ * @internal
+ *
+ * @since 4.2.5
+ */
+class AdaptiveWindow
+{
+    private int $limit;
+    private int $size;
+
+    /**
+     * @param int $limit the maximum number of operations in flight
+     *
+     * @internal
+     *
+     * @since 4.2.5
+     */
+    public function __construct(int $limit)
+    {
+        $this->limit = max(1, $limit);
+        $this->size = $this->limit;
+    }
+
+    /**
+     * @return int number of operations to send in the next window
+     * @internal
+     *
+     * @since 4.2.5
+     */
+    public function size(): int
+    {
+        return $this->size;
+    }
+
+    /**
+     * Adjusts the size of the window using the responses of the completed window.
+     *
+     * @param array $responses raw responses of the multi-operation
+     *
+     * @internal
+     *
+     * @since 4.2.5
+     */
+    public function record(array $responses): void
+    {
+        foreach ($responses as $response) {
+            if (array_key_exists("error", $response) && $response["error"] instanceof TimeoutException) {
+                $this->size = max(1, intdiv($this->size, 2));
+                return;
+            }
+        }
+        $this->size = min($this->limit, $this->size + max(1, intdiv($this->limit, 8)));
+    }
+
+    /**
+     * Sends the entries in consecutive windows.
+     *
+     * @param array $entries entries of the multi-operation
+     * @param int|null $limit the maximum number of operations in flight, or null to send everything at once
+     * @param callable $dispatcher sends list of entries and returns list of raw responses
+     *
+     * @return array list of raw responses, one for each of the entries
+     * @internal
+     *
+     * @since 4.2.5
+     */
+    public static function dispatch(array $entries, ?int $limit, callable $dispatcher): array
+    {
+        if ($limit == null || count($entries) <= $limit) {
+            return $dispatcher(array_values($entries));
+        }
+        $window = new AdaptiveWindow($limit);
+        $entries = array_values($entries);
+        $responses = [];
+        $offset = 0;
+        while ($offset < count($entries)) {
+            $chunk = array_slice($entries, $offset, $window->size());
+            $offset += count($chunk);
+            $chunkResponses = $dispatcher($chunk);
+            $window->record($chunkResponses);
+            foreach ($chunkResponses as $response) {
+                $responses[] = $response;
+            }
+        }
+        return $responses;
+    }
+}
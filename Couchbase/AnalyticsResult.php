@@ -20,13 +20,18 @@ declare(strict_types=1);
 
 namespace Couchbase;
 
+use IteratorAggregate;
+use Traversable;
+
 /**
  * Interface for retrieving results from analytics queries.
  */
-class AnalyticsResult
+class AnalyticsResult implements IteratorAggregate
 {
     private AnalyticsMetaData $meta;
-    private array $rows;
+    private Transcoder $transcoder;
+    private array $encodedRows;
+    private ?array $rows = null;
 
     /**
      * @internal
@@ -37,11 +42,8 @@ class AnalyticsResult
     public function __construct(array $result, Transcoder $transcoder)
     {
         $this->meta = new AnalyticsMetaData($result["meta"]);
-
-        $this->rows = [];
-        foreach ($result["rows"] as $row) {
-            $this->rows[] = $transcoder->decode($row, 0);
-        }
+        $this->transcoder = $transcoder;
+        $this->encodedRows = $result["rows"];
     }
 
     /**
@@ -63,6 +65,24 @@ class AnalyticsResult
      */
     public function rows(): ?array
     {
+        if ($this->rows === null) {
+            $this->rows = RowIterator::decodeAll($this->encodedRows, $this->transcoder);
+            $this->encodedRows = [];
+        }
         return $this->rows;
     }
+
+    /**
+     * Returns the iterator which decodes the rows one at a time, as they are consumed, instead of decoding
+     * the whole result set up front like rows() does.
+     *
+     * @return Traversable
+     * @since 4.2.5
+     */
+    public function getIterator(): Traversable
+    {
+        return RowIterator::create($this->rows, $this->encodedRows, function ($row) {
+            return $this->transcoder->decode($row, 0);
+        });
+    }
 }
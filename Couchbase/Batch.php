@@ -0,0 +1,304 @@
+<?php
+
+/**
+ * Copyright 2014-Present Couchbase, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+declare(strict_types=1);
+
+namespace Couchbase;
+
+use Couchbase\Exception\CouchbaseException;
+
+/**
+ * Batch is a builder for a list of mixed key-value operations, possibly against different collections, that are
+ * executed together.
+ *
+ * Consecutive gets, upserts and removes against the same collection with the same options are grouped, and each
+ * group is sent to the server in a single multi-operation call. The groups are sent one after another, each call
+ * blocking until all of its operations have completed, so they keep the order in which they were added. The
+ * remaining kinds of operations do not have multi-operation counterparts, and are executed one by one after all
+ * groups have completed. The batch saves round trips for the grouped operations, but it does not execute anything
+ * concurrently.
+ *
+ * Because the operations without multi-operation counterparts run after the groups, they should not depend on
+ * the grouped operations on the same document.
+ *
+ * @since 4.2.5
+ */
+class Batch
+{
+    /**
+     * @var array<callable>
+     */
+    private array $operations = [];
+
+    /**
+     * Static helper to keep code more readable
+     *
+     * @return Batch
+     * @since 4.2.5
+     */
+    public static function build(): Batch
+    {
+        return new Batch();
+    }
+
+    /**
+     * Adds fetching of the document.
+     *
+     * @param Collection $collection the collection the document lives in
+     * @param string $id the key of the document to fetch
+     * @param GetOptions|null $options the options to use for the operation
+     *
+     * @return Batch
+     * @since 4.2.5
+     */
+    public function get(Collection $collection, string $id, ?GetOptions $options = null): Batch
+    {
+        $this->operations[] = $this->grouped($id, function () use ($collection, $id, $options) {
+            return $collection->getAsync($id, $options);
+        });
+        return $this;
+    }
+
+    /**
+     * Adds creation or update of the document.
+     *
+     * @param Collection $collection the collection the document lives in
+     * @param string $id the key of the document
+     * @param mixed $value the value to use for the document
+     * @param UpsertOptions|null $options the options to use for the operation
+     *
+     * @return Batch
+     * @since 4.2.5
+     */
+    public function upsert(Collection $collection, string $id, $value, ?UpsertOptions $options = null): Batch
+    {
+        $this->operations[] = $this->grouped($id, function () use ($collection, $id, $value, $options) {
+            return $collection->upsertAsync($id, $value, $options);
+        });
+        return $this;
+    }
+
+    /**
+     * Adds insertion of the document.
+     *
+     * @param Collection $collection the collection the document lives in
+     * @param string $id the key of the document
+     * @param mixed $value the value to use for the document
+     * @param InsertOptions|null $options the options to use for the operation
+     *
+     * @return Batch
+     * @since 4.2.5
+     */
+    public function insert(Collection $collection, string $id, $value, ?InsertOptions $options = null): Batch
+    {
+        $this->operations[] = $this->deferred($id, function () use ($collection, $id, $value, $options) {
+            return $collection->insert($id, $value, $options);
+        });
+        return $this;
+    }
+
+    /**
+     * Adds replacement of the document.
+     *
+     * @param Collection $collection the collection the document lives in
+     * @param string $id the key of the document
+     * @param mixed $value the value to use for the document
+     * @param ReplaceOptions|null $options the options to use for the operation
+     *
+     * @return Batch
+     * @since 4.2.5
+     */
+    public function replace(Collection $collection, string $id, $value, ?ReplaceOptions $options = null): Batch
+    {
+        $this->operations[] = $this->deferred($id, function () use ($collection, $id, $value, $options) {
+            return $collection->replace($id, $value, $options);
+        });
+        return $this;
+    }
+
+    /**
+     * Adds removal of the document.
+     *
+     * @param Collection $collection the collection the document lives in
+     * @param string $id the key of the document
+     * @param RemoveOptions|null $options the options to use for the operation
+     *
+     * @return Batch
+     * @since 4.2.5
+     */
+    public function remove(Collection $collection, string $id, ?RemoveOptions $options = null): Batch
+    {
+        $this->operations[] = $this->grouped($id, function () use ($collection, $id, $options) {
+            return $collection->removeAsync($id, $options);
+        });
+        return $this;
+    }
+
+    /**
+     * Adds a set of subdocument lookup operations against the document.
+     *
+     * @param Collection $collection the collection the document lives in
+     * @param string $id the key of the document
+     * @param array<LookupInSpec> $specs the array of selectors to query against the document
+     * @param LookupInOptions|null $options the options to use for the operation
+     *
+     * @return Batch
+     * @since 4.2.5
+     */
+    public function lookupIn(Collection $collection, string $id, array $specs, ?LookupInOptions $options = null): Batch
+    {
+        $this->operations[] = $this->deferred($id, function () use ($collection, $id, $specs, $options) {
+            return $collection->lookupIn($id, $specs, $options);
+        });
+        return $this;
+    }
+
+    /**
+     * Adds a set of subdocument mutations against the document.
+     *
+     * @param Collection $collection the collection the document lives in
+     * @param string $id the key of the document
+     * @param array<MutateInSpec> $specs the array of modifications to perform against the document
+     * @param MutateInOptions|null $options the options to use for the operation
+     *
+     * @return Batch
+     * @since 4.2.5
+     */
+    public function mutateIn(Collection $collection, string $id, array $specs, ?MutateInOptions $options = null): Batch
+    {
+        $this->operations[] = $this->deferred($id, function () use ($collection, $id, $specs, $options) {
+            return $collection->mutateIn($id, $specs, $options);
+        });
+        return $this;
+    }
+
+    /**
+     * Adds increment of the counter document.
+     *
+     * @param Collection $collection the collection the document lives in
+     * @param string $id the key of the document
+     * @param IncrementOptions|null $options the options to use for the operation
+     *
+     * @return Batch
+     * @since 4.2.5
+     */
+    public function increment(Collection $collection, string $id, ?IncrementOptions $options = null): Batch
+    {
+        $this->operations[] = $this->deferred($id, function () use ($collection, $id, $options) {
+            return $collection->binary()->increment($id, $options);
+        });
+        return $this;
+    }
+
+    /**
+     * Adds decrement of the counter document.
+     *
+     * @param Collection $collection the collection the document lives in
+     * @param string $id the key of the document
+     * @param DecrementOptions|null $options the options to use for the operation
+     *
+     * @return Batch
+     * @since 4.2.5
+     */
+    public function decrement(Collection $collection, string $id, ?DecrementOptions $options = null): Batch
+    {
+        $this->operations[] = $this->deferred($id, function () use ($collection, $id, $options) {
+            return $collection->binary()->decrement($id, $options);
+        });
+        return $this;
+    }
+
+    /**
+     * Executes all operations of the batch. It does not throw if an individual operation has failed, but fills
+     * error() property of its result object, like multi-operations do.
+     *
+     * @return array<Result> array of results, one for each of the operations, in the order they were added
+     * @since 4.2.5
+     */
+    public function execute(): array
+    {
+        $started = array_map(
+            function (callable $operation) {
+                return $operation();
+            },
+            $this->operations
+        );
+        foreach ($started as [$pending]) {
+            if ($pending != null) {
+                $pending->dispatch();
+            }
+        }
+        return array_map(
+            function (array $operation) {
+                return $operation[1]();
+            },
+            $started
+        );
+    }
+
+    /**
+     * Wraps operation which has multi-operation counterpart, so that it is enqueued into its group when the batch is
+     * executed, and the failure of the operation or of the whole group is reported through the result object.
+     *
+     * @param string $id the key of the document
+     * @param callable $operation the asynchronous operation returning PendingResult
+     *
+     * @return callable
+     */
+    private function grouped(string $id, callable $operation): callable
+    {
+        return function () use ($id, $operation) {
+            $pending = $operation();
+            return [
+                $pending,
+                function () use ($id, $pending) {
+                    try {
+                        return $pending->result();
+                    } catch (CouchbaseException $exception) {
+                        return new Result(["id" => $id, "error" => $exception]);
+                    }
+                },
+            ];
+        };
+    }
+
+    /**
+     * Wraps operation which does not have multi-operation counterpart, so that it is executed after all groups have
+     * been sent, and its failure is reported through the result object.
+     *
+     * @param string $id the key of the document
+     * @param callable $operation the synchronous operation
+     *
+     * @return callable
+     */
+    private function deferred(string $id, callable $operation): callable
+    {
+        return function () use ($id, $operation) {
+            return [
+                null,
+                function () use ($id, $operation) {
+                    try {
+                        return $operation();
+                    } catch (CouchbaseException $exception) {
+                        return new Result(["id" => $id, "error" => $exception]);
+                    }
+                },
+            ];
+        };
+    }
+}
@@ -80,6 +80,7 @@ class BinaryCollection implements BinaryCollectionInterface
      */
     public function append(string $id, string $value, ?AppendOptions $options = null): MutationResult
     {
+        ReadCache::invalidateDocument($this->bucketName, $this->scopeName, $this->name, $id);
         $response = Extension\documentAppend(
             $this->core,
             $this->bucketName,
@@ -107,6 +108,7 @@ class BinaryCollection implements BinaryCollectionInterface
      */
     public function prepend(string $id, string $value, ?PrependOptions $options = null): MutationResult
     {
+        ReadCache::invalidateDocument($this->bucketName, $this->scopeName, $this->name, $id);
         $response = Extension\documentPrepend(
             $this->core,
             $this->bucketName,
@@ -133,6 +135,7 @@ class BinaryCollection implements BinaryCollectionInterface
      */
     public function increment(string $id, ?IncrementOptions $options = null): CounterResult
     {
+        ReadCache::invalidateDocument($this->bucketName, $this->scopeName, $this->name, $id);
         $response = Extension\documentIncrement(
             $this->core,
             $this->bucketName,
@@ -158,6 +161,7 @@ class BinaryCollection implements BinaryCollectionInterface
      */
     public function decrement(string $id, ?DecrementOptions $options = null): CounterResult
     {
+        ReadCache::invalidateDocument($this->bucketName, $this->scopeName, $this->name, $id);
         $response = Extension\documentDecrement(
             $this->core,
             $this->bucketName,
@@ -20,6 +20,8 @@ declare(strict_types=1);
 
 namespace Couchbase;
 
+use Couchbase\Exception\CouchbaseException;
+use Couchbase\Exception\InvalidArgumentException;
 use Couchbase\Exception\UnsupportedOperationException;
 use Couchbase\Management\CollectionManager;
 use Couchbase\Management\ViewIndexManager;
@@ -37,19 +39,34 @@ class Bucket implements BucketInterface
      * @var resource
      */
     private $core;
+    private ?ReadCache $readCache;
+    private ?PreparedStatementCache $preparedStatements;
+    private bool $preparedStatementCache;
 
     /**
      * @param string $name
      * @param resource $core
+     * @param ReadCache|null $readCache
+     * @param PreparedStatementCache|null $preparedStatements
+     * @param bool $preparedStatementCache whether non-adhoc queries always go through the prepared statement cache
      *
      * @internal
      *
      * @since 4.0.0
      */
-    public function __construct(string $name, $core)
+    public function __construct(
+        string $name,
+        $core,
+        ?ReadCache $readCache = null,
+        ?PreparedStatementCache $preparedStatements = null,
+        bool $preparedStatementCache = false
+    )
     {
         $this->name = $name;
         $this->core = $core;
+        $this->readCache = $readCache;
+        $this->preparedStatements = $preparedStatements;
+        $this->preparedStatementCache = $preparedStatementCache;
         Extension\openBucket($this->core, $this->name);
     }
 
@@ -61,7 +78,14 @@ class Bucket implements BucketInterface
      */
     public function defaultScope(): ScopeInterface
     {
-        return new Scope("_default", $this->name, $this->core);
+        return new Scope(
+            "_default",
+            $this->name,
+            $this->core,
+            $this->readCache,
+            $this->preparedStatements,
+            $this->preparedStatementCache
+        );
     }
 
     /**
@@ -72,7 +96,7 @@ class Bucket implements BucketInterface
      */
     public function defaultCollection(): CollectionInterface
     {
-        return new Collection("_default", "_default", $this->name, $this->core);
+        return new Collection("_default", "_default", $this->name, $this->core, $this->readCache);
     }
 
     /**
@@ -85,7 +109,53 @@ class Bucket implements BucketInterface
      */
     public function scope(string $name): ScopeInterface
     {
-        return new Scope($name, $this->name, $this->core);
+        return new Scope(
+            $name,
+            $this->name,
+            $this->core,
+            $this->readCache,
+            $this->preparedStatements,
+            $this->preparedStatementCache
+        );
+    }
+
+    /**
+     * Resolves collection identifiers for the given keyspaces ahead of time, so that the first key-value operation
+     * against them does not have to wait for the resolution.
+     *
+     * The identifiers are cached by the connection, so for persistent connections it is enough to warm up once per
+     * process. The resolution is triggered by checking existence of a placeholder key, whose result is discarded.
+     * The method is not an existence check for the bucket or the collections; use
+     * CollectionManager::getAllScopes() for that.
+     *
+     * @param array<string> $keyspaces list of keyspaces in form "scope.collection"
+     * @param int|null $timeoutMilliseconds timeout for each of the lookups
+     *
+     * @throws InvalidArgumentException
+     * @throws CouchbaseException
+     * @since 4.2.5
+     */
+    public function warmup(array $keyspaces, ?int $timeoutMilliseconds = null): void
+    {
+        $options = ExistsOptions::build();
+        if ($timeoutMilliseconds !== null) {
+            $options->timeout($timeoutMilliseconds);
+        }
+        foreach ($keyspaces as $keyspace) {
+            $parts = explode(".", $keyspace);
+            if (count($parts) != 2 || $parts[0] == "" || $parts[1] == "") {
+                throw new InvalidArgumentException(sprintf("keyspace must be in form \"scope.collection\": %s", $keyspace));
+            }
+            // any key-value operation makes the core resolve and cache the collection identifier
+            Extension\documentExists(
+                $this->core,
+                $this->name,
+                $parts[0],
+                $parts[1],
+                "__couchbase_warmup",
+                ExistsOptions::export($options)
+            );
+        }
     }
 
     /**
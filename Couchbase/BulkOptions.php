@@ -0,0 +1,179 @@
+<?php
+
+/**
+ * Copyright 2014-Present Couchbase, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+declare(strict_types=1);
+
+namespace Couchbase;
+
+use Couchbase\Exception\InvalidArgumentException;
+
+class BulkOptions
+{
+    private ?UpsertOptions $upsertOptions = null;
+    private int $windowSize = 128;
+    private int $maxRetries = 3;
+    private int $retryBackoffMilliseconds = 10;
+    private int $maxRetryBackoffMilliseconds = 1000;
+    /**
+     * @var callable|null
+     */
+    private $progressCallback = null;
+
+    /**
+     * Static helper to keep code more readable
+     *
+     * @return BulkOptions
+     * @since 4.2.5
+     */
+    public static function build(): BulkOptions
+    {
+        return new BulkOptions();
+    }
+
+    /**
+     * Sets the options for the individual upserts (expiry, durability, transcoder, timeout etc.).
+     *
+     * @param UpsertOptions $options
+     *
+     * @return BulkOptions
+     * @since 4.2.5
+     */
+    public function upsertOptions(UpsertOptions $options): BulkOptions
+    {
+        $this->upsertOptions = $options;
+        return $this;
+    }
+
+    /**
+     * Sets the maximum number of documents sent to the server in one multi-operation. The window shrinks when
+     * operations time out, and grows back to this size afterwards.
+     *
+     * @param int $numberOfDocuments
+     *
+     * @return BulkOptions
+     * @throws InvalidArgumentException
+     * @since 4.2.5
+     */
+    public function windowSize(int $numberOfDocuments): BulkOptions
+    {
+        if ($numberOfDocuments < 1) {
+            throw new InvalidArgumentException("Window size must be positive");
+        }
+        $this->windowSize = $numberOfDocuments;
+        return $this;
+    }
+
+    /**
+     * Sets how many times the documents failed with temporary errors are sent again.
+     *
+     * @param int $numberOfRetries
+     *
+     * @return BulkOptions
+     * @throws InvalidArgumentException
+     * @since 4.2.5
+     */
+    public function maxRetries(int $numberOfRetries): BulkOptions
+    {
+        if ($numberOfRetries < 0) {
+            throw new InvalidArgumentException("Number of retries must not be negative");
+        }
+        $this->maxRetries = $numberOfRetries;
+        return $this;
+    }
+
+    /**
+     * Sets how long the bulk load waits before sending again the documents of the window, that failed with
+     * temporary errors. The wait doubles with every retry of the same window.
+     *
+     * @param int $initialMilliseconds wait before the first retry of the window
+     * @param int $maxMilliseconds upper bound for the wait
+     *
+     * @return BulkOptions
+     * @throws InvalidArgumentException
+     * @since 4.2.5
+     */
+    public function retryBackoff(int $initialMilliseconds, int $maxMilliseconds): BulkOptions
+    {
+        if ($initialMilliseconds < 0 || $maxMilliseconds < $initialMilliseconds) {
+            throw new InvalidArgumentException(
+                sprintf("Bulk retry wait must be between 0 and %d ms, got %d ms", $maxMilliseconds, $initialMilliseconds)
+            );
+        }
+        $this->retryBackoffMilliseconds = $initialMilliseconds;
+        $this->maxRetryBackoffMilliseconds = $maxMilliseconds;
+        return $this;
+    }
+
+    /**
+     * Sets the function invoked after every window with the BulkResult accumulated so far.
+     *
+     * @param callable $callback
+     *
+     * @return BulkOptions
+     * @since 4.2.5
+     */
+    public function progress(callable $callback): BulkOptions
+    {
+        $this->progressCallback = $callback;
+        return $this;
+    }
+
+    /**
+     * @param BulkOptions|null $options
+     *
+     * @return UpsertOptions|null
+     * @internal
+     * @since 4.2.5
+     */
+    public static function getUpsertOptions(?BulkOptions $options): ?UpsertOptions
+    {
+        return $options == null ? null : $options->upsertOptions;
+    }
+
+    /**
+     * @param BulkOptions|null $options
+     *
+     * @return callable|null
+     * @internal
+     * @since 4.2.5
+     */
+    public static function getProgressCallback(?BulkOptions $options): ?callable
+    {
+        return $options == null ? null : $options->progressCallback;
+    }
+
+    /**
+     * @param BulkOptions|null $options
+     *
+     * @return array
+     * @internal
+     * @since 4.2.5
+     */
+    public static function export(?BulkOptions $options): array
+    {
+        if ($options == null) {
+            $options = new BulkOptions();
+        }
+        return [
+            'windowSize' => $options->windowSize,
+            'maxRetries' => $options->maxRetries,
+            'retryBackoff' => $options->retryBackoffMilliseconds,
+            'maxRetryBackoff' => $options->maxRetryBackoffMilliseconds,
+        ];
+    }
+}
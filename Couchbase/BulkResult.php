@@ -0,0 +1,139 @@
+<?php
+
+/**
+ * Copyright 2014-Present Couchbase, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+declare(strict_types=1);
+
+namespace Couchbase;
+
+use Couchbase\Exception\CouchbaseException;
+
+/**
+ * Outcome of the bulk load. The same object is passed to the progress callback while the load is running.
+ *
+ * Only the failed documents are remembered, so the memory used by the result does not depend on the size of
+ * the source.
+ */
+class BulkResult
+{
+    private float $startTime;
+    private int $succeeded = 0;
+    private int $retried = 0;
+    private int $failures = 0;
+    /**
+     * @var array<string, CouchbaseException>
+     */
+    private array $failed = [];
+
+    /**
+     * @internal
+     *
+     * @since 4.2.5
+     */
+    public function __construct()
+    {
+        $this->startTime = microtime(true);
+    }
+
+    /**
+     * @return int number of documents stored successfully
+     * @since 4.2.5
+     */
+    public function succeeded(): int
+    {
+        return $this->succeeded;
+    }
+
+    /**
+     * If the source contained the same ID more than once, only the last error for it is kept.
+     *
+     * @return array<string, CouchbaseException> errors of the documents that could not be stored, keyed by ID
+     * @since 4.2.5
+     */
+    public function failed(): array
+    {
+        return $this->failed;
+    }
+
+    /**
+     * @return int number of documents taken from the source so far
+     * @since 4.2.5
+     */
+    public function processed(): int
+    {
+        return $this->succeeded + $this->failures;
+    }
+
+    /**
+     * @return int number of times the documents have been sent again after temporary errors
+     * @since 4.2.5
+     */
+    public function retried(): int
+    {
+        return $this->retried;
+    }
+
+    /**
+     * @return float seconds elapsed since the start of the load
+     * @since 4.2.5
+     */
+    public function elapsed(): float
+    {
+        return microtime(true) - $this->startTime;
+    }
+
+    /**
+     * @return float documents processed per second
+     * @since 4.2.5
+     */
+    public function throughput(): float
+    {
+        $elapsed = $this->elapsed();
+        return $elapsed > 0 ? $this->processed() / $elapsed : 0.0;
+    }
+
+    /**
+     * @internal
+     *
+     * @since 4.2.5
+     */
+    public function recordSuccess(): void
+    {
+        ++$this->succeeded;
+    }
+
+    /**
+     * @internal
+     *
+     * @since 4.2.5
+     */
+    public function recordRetry(): void
+    {
+        ++$this->retried;
+    }
+
+    /**
+     * @internal
+     *
+     * @since 4.2.5
+     */
+    public function recordFailure(string $id, CouchbaseException $error): void
+    {
+        ++$this->failures;
+        $this->failed[$id] = $error;
+    }
+}
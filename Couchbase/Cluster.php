@@ -47,6 +47,8 @@ class Cluster implements ClusterInterface
      * @var resource
      */
     private $core;
+    private ?ReadCache $readCache = null;
+    private PreparedStatementCache $preparedStatements;
 
     /**
      * @throws InvalidArgumentException
@@ -59,9 +61,16 @@ class Cluster implements ClusterInterface
         ) {
             throw new InvalidArgumentException("Please use Cluster::connect() to connect to CNG.");
         }
+        if ($options->getRetryBudget() != null || $options->getMaxRetryAttempts() !== null || $options->getRetryBackoffJitter()) {
+            throw new InvalidArgumentException("Retry budget and retry strategy are only supported for couchbase2:// connections.");
+        }
         $this->connectionHash = hash("sha256", sprintf("--%s--%s--", $connectionString, $options->authenticatorHash()));
         $this->core = Extension\createConnection($this->connectionHash, $connectionString, $options->export());
         $this->options = $options;
+        if ($options->getReadCacheOptions() != null) {
+            $this->readCache = ReadCache::forConnection($this->connectionHash, $options->getReadCacheOptions());
+        }
+        $this->preparedStatements = PreparedStatementCache::forConnection($this->connectionHash);
     }
 
     /**
@@ -139,6 +148,59 @@ class Cluster implements ClusterInterface
         return Extension\notifyFork($event);
     }
 
+    /**
+     * Waits for completion of all given asynchronous operations.
+     *
+     * All groups of operations, that have not been sent yet, are sent to the server before waiting for any of them,
+     * so the total latency is the latency of the slowest group. Like multi-operations, it does not throw if an
+     * individual operation has failed, but fills error() property of the corresponding result object.
+     *
+     * @param array<PendingResult> $pendingResults handles returned by asynchronous methods of the Collection
+     *
+     * @return array<Result> array of results with the same keys as the input array
+     * @throws CouchbaseException
+     * @since 4.2.5
+     */
+    public static function waitAll(array $pendingResults): array
+    {
+        foreach ($pendingResults as $pendingResult) {
+            $pendingResult->dispatch();
+        }
+        return array_map(
+            function (PendingResult $pendingResult) {
+                return $pendingResult->result();
+            },
+            $pendingResults
+        );
+    }
+
+    /**
+     * Waits for completion of at least one of the given asynchronous operations.
+     *
+     * If none of the operations is ready, only the group of the first one is sent to the server.
+     *
+     * @param array<PendingResult> $pendingResults handles returned by asynchronous methods of the Collection
+     *
+     * @return int|string the key of the completed operation in the input array
+     * @throws InvalidArgumentException if the array is empty
+     * @throws CouchbaseException
+     * @since 4.2.5
+     */
+    public static function waitAny(array $pendingResults)
+    {
+        if (count($pendingResults) == 0) {
+            throw new InvalidArgumentException("expected at least one pending result to wait for");
+        }
+        foreach ($pendingResults as $key => $pendingResult) {
+            if ($pendingResult->isReady()) {
+                return $key;
+            }
+        }
+        $key = array_key_first($pendingResults);
+        $pendingResults[$key]->dispatch();
+        return $key;
+    }
+
     /**
      * Returns a new bucket object.
      *
@@ -149,7 +211,13 @@ class Cluster implements ClusterInterface
      */
     public function bucket(string $name): BucketInterface
     {
-        return new Bucket($name, $this->core);
+        return new Bucket(
+            $name,
+            $this->core,
+            $this->readCache,
+            $this->preparedStatements,
+            $this->options->getPreparedStatementCache()
+        );
     }
 
     /**
@@ -167,11 +235,53 @@ class Cluster implements ClusterInterface
      */
     public function query(string $statement, ?QueryOptions $options = null): QueryResult
     {
-        $result = Extension\query($this->core, $statement, QueryOptions::export($options));
+        $exported = QueryOptions::export($options);
+        if (
+            !QueryOptions::isAdhoc($options) &&
+            ($this->options->getPreparedStatementCache() || $this->preparedStatements->contains($statement, $exported['queryContext']))
+        ) {
+            $result = $this->preparedStatements->execute($this->core, $statement, $exported);
+        } else {
+            $result = Extension\query($this->core, $statement, $exported);
+        }
 
         return new QueryResult($result, QueryOptions::getTranscoder($options));
     }
 
+    /**
+     * Prepares the query statement on the query service ahead of time, e.g. during warm-up of the worker.
+     *
+     * Once prepared, the statement is executed by name by Cluster::query() with non-adhoc options, even if
+     * ClusterOptions::preparedStatementCache() has not been enabled. Statements prepared with the query context of
+     * a scope are used the same way by Scope::query().
+     *
+     * @param string $statement the N1QL query statement to prepare
+     * @param QueryOptions|null $options the options used to execute the query later (only query context and
+     *     timeout are relevant)
+     *
+     * @throws TimeoutException
+     * @throws CouchbaseException
+     * @see QueryOptions::adhoc()
+     * @since 4.2.5
+     */
+    public function prepare(string $statement, ?QueryOptions $options = null): void
+    {
+        $this->preparedStatements->prepare($this->core, $statement, QueryOptions::export($options));
+    }
+
+    /**
+     * Returns counters of the prepared statement cache shared by the connection: number of tracked statements,
+     * executions of already prepared statements (hits), statements that had to be prepared (misses), and plans
+     * reported as stale by the query service (invalidations).
+     *
+     * @return array
+     * @since 4.2.5
+     */
+    public function preparedStatementStats(): array
+    {
+        return $this->preparedStatements->stats();
+    }
+
     /**
      * Executes an analytics query against the cluster.
      * Note: On Couchbase Server versions < 6.5 a bucket must be opened before using analyticsQuery.
@@ -65,6 +65,11 @@ class ClusterOptions
     private ?ThresholdLoggingOptions $thresholdLoggingTracerOptions = null;
     private ?LoggingMeterOptions $loggingMeterOptions = null;
     private ?TransactionsConfiguration $transactionsConfiguration = null;
+    private ?ReadCacheOptions $readCacheOptions = null;
+    private bool $preparedStatementCache = false;
+    private ?array $retryBudget = null;
+    private ?int $maxRetryAttempts = null;
+    private bool $retryBackoffJitter = false;
 
     private ?Authenticator $authenticator;
 
@@ -489,6 +494,109 @@ class ClusterOptions
         return $this;
     }
 
+    /**
+     * Enables in-process cache for the documents fetched with Collection::get() and Collection::getMulti().
+     *
+     * The cache is shared by all Cluster objects of the process, that use the same connection string, credentials
+     * and cache options. Its entries are invalidated only by the key-value mutations performed by the process
+     * through Collection, BinaryCollection and transactions. Documents changed with N1QL statements (also inside
+     * transactions), through couchbase2:// clusters, or by other processes are served stale until the TTL of the
+     * entry expires. Individual gets can skip the cache using GetOptions::bypassReadCache().
+     *
+     * @param ReadCacheOptions $options
+     *
+     * @return ClusterOptions
+     * @since 4.2.5
+     */
+    public function readCache(ReadCacheOptions $options): ClusterOptions
+    {
+        $this->readCacheOptions = $options;
+        return $this;
+    }
+
+    /**
+     * Executes non-adhoc queries of Cluster::query() and Scope::query() as named prepared statements.
+     *
+     * The names are derived from the statement text, so the statements prepared by one process are reused by all
+     * other processes connected to the cluster, and a recycled worker does not have to prepare them again. Stale
+     * statements reported by the query service are prepared once more transparently.
+     *
+     * @param bool $enabled
+     *
+     * @return ClusterOptions
+     * @see QueryOptions::adhoc()
+     * @see Cluster::prepare()
+     * @since 4.2.5
+     */
+    public function preparedStatementCache(bool $enabled): ClusterOptions
+    {
+        $this->preparedStatementCache = $enabled;
+        return $this;
+    }
+
+    /**
+     * Limits the rate of retries performed by the process with a token bucket, so that workers do not flood the
+     * cluster with retries while it recovers (e.g. during rebalance). Once the budget is exhausted, requests fail
+     * with RequestCanceledException instead of being retried.
+     *
+     * Note: the budget is only supported for the couchbase2:// connections, where the retries are performed by
+     * the SDK itself. Other connections reject the options with InvalidArgumentException. The budget is shared by
+     * the whole process, so all clusters should use the same settings, otherwise the last one wins.
+     *
+     * @param int $capacity maximum number of retries allowed in a burst
+     * @param float $refillPerSecond number of retries added back to the budget every second
+     *
+     * @return ClusterOptions
+     * @throws InvalidArgumentException
+     * @since 4.2.5
+     */
+    public function retryBudget(int $capacity, float $refillPerSecond): ClusterOptions
+    {
+        if ($capacity < 1 || $refillPerSecond < 0) {
+            throw new InvalidArgumentException("Retry budget capacity must be positive, and refill rate must not be negative");
+        }
+        $this->retryBudget = [$capacity, $refillPerSecond];
+        return $this;
+    }
+
+    /**
+     * Limits the number of times a single request is retried, before it fails with RequestCanceledException.
+     * Without the limit, requests are retried until their timeout.
+     *
+     * Note: only supported for the couchbase2:// connections, and shared by the whole process like retryBudget().
+     *
+     * @param int $attempts maximum number of retries of the request
+     *
+     * @return ClusterOptions
+     * @throws InvalidArgumentException
+     * @since 4.2.5
+     */
+    public function maxRetryAttempts(int $attempts): ClusterOptions
+    {
+        if ($attempts < 0) {
+            throw new InvalidArgumentException("Maximum number of retry attempts must not be negative");
+        }
+        $this->maxRetryAttempts = $attempts;
+        return $this;
+    }
+
+    /**
+     * Randomizes the delay before each retry within the upper half of the backoff, so that requests failed at
+     * the same time are not retried at the same time.
+     *
+     * Note: only supported for the couchbase2:// connections, and shared by the whole process like retryBudget().
+     *
+     * @param bool $enable
+     *
+     * @return ClusterOptions
+     * @since 4.2.5
+     */
+    public function retryBackoffJitter(bool $enable): ClusterOptions
+    {
+        $this->retryBackoffJitter = $enable;
+        return $this;
+    }
+
     /**
      * Applies configuration profile to ClusterOptions associating string to range of options
      * @param string $profile name of config profile to apply (e.g. wan_development)
@@ -509,6 +617,51 @@ class ClusterOptions
         return $this->transactionsConfiguration;
     }
 
+    /**
+     * @return ReadCacheOptions|null
+     * @since 4.2.5
+     */
+    public function getReadCacheOptions(): ?ReadCacheOptions
+    {
+        return $this->readCacheOptions;
+    }
+
+    /**
+     * @return bool
+     * @since 4.2.5
+     */
+    public function getPreparedStatementCache(): bool
+    {
+        return $this->preparedStatementCache;
+    }
+
+    /**
+     * @return array|null tuple of capacity and refill rate of the retry budget
+     * @since 4.2.5
+     */
+    public function getRetryBudget(): ?array
+    {
+        return $this->retryBudget;
+    }
+
+    /**
+     * @return int|null maximum number of retries of the single request, or null if not limited
+     * @since 4.2.5
+     */
+    public function getMaxRetryAttempts(): ?int
+    {
+        return $this->maxRetryAttempts;
+    }
+
+    /**
+     * @return bool true if the retry backoff is randomized
+     * @since 4.2.5
+     */
+    public function getRetryBackoffJitter(): bool
+    {
+        return $this->retryBackoffJitter;
+    }
+
     /**
      * @return string the string that uniquely identifies particular authenticator layout
      * @throws InvalidArgumentException
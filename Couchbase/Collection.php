@@ -26,9 +26,11 @@ use Couchbase\Exception\DocumentIrretrievableException;
 use Couchbase\Exception\DocumentNotFoundException;
 use Couchbase\Exception\CouchbaseException;
 use Couchbase\Exception\InvalidArgumentException;
+use Couchbase\Exception\TemporaryFailureException;
 use Couchbase\Exception\TimeoutException;
 use Couchbase\Exception\UnsupportedOperationException;
 use Couchbase\Management\CollectionQueryIndexManager;
+use Couchbase\Utilities\Backoff;
 use DateTimeInterface;
 
 /**
@@ -43,23 +45,28 @@ class Collection implements CollectionInterface
      * @var resource
      */
     private $core;
+    private ?ReadCache $readCache;
+    private ?string $pendingGroup = null;
+    private ?PendingOperationBatch $pendingBatch = null;
 
     /**
      * @param string $name
      * @param string $scopeName
      * @param string $bucketName
      * @param resource $core
+     * @param ReadCache|null $readCache
      *
      * @internal
      *
      * @since 4.0.0
      */
-    public function __construct(string $name, string $scopeName, string $bucketName, $core)
+    public function __construct(string $name, string $scopeName, string $bucketName, $core, ?ReadCache $readCache = null)
     {
         $this->name = $name;
         $this->scopeName = $scopeName;
         $this->bucketName = $bucketName;
         $this->core = $core;
+        $this->readCache = $readCache;
     }
 
 
@@ -115,14 +122,33 @@ class Collection implements CollectionInterface
      */
     public function get(string $id, ?GetOptions $options = null): GetResult
     {
+        $cacheable = $this->readCache != null && GetOptions::isReadCacheable($options);
+        if ($cacheable && !GetOptions::bypassesReadCache($options)) {
+            $response = $this->readCache->get(ReadCache::key($this->bucketName, $this->scopeName, $this->name, $id));
+            if ($response != null) {
+                return new GetResult($response, GetOptions::getTranscoder($options));
+            }
+        }
+        $fallbackOptions = GetOptions::replicaFallbackOptions($options);
+        if ($fallbackOptions != null) {
+            $this->flushPendingOperations();
+            return $this->getWithReplicaFallback($id, $fallbackOptions[0], $fallbackOptions[1], $cacheable);
+        }
+        if (FiberScheduler::inManagedFiber()) {
+            return FiberScheduler::await($this->startGet($id, $options, $cacheable));
+        }
+        $this->flushPendingOperations();
         $response = Extension\documentGet(
             $this->core,
             $this->bucketName,
             $this->scopeName,
             $this->name,
             $id,
-            GetOptions::export($options)
+            $cacheable ? GetOptions::exportForReadCache($options) : GetOptions::export($options)
         );
+        if ($cacheable) {
+            $this->readCache->put(ReadCache::key($this->bucketName, $this->scopeName, $this->name, $id), $response);
+        }
         return new GetResult($response, GetOptions::getTranscoder($options));
     }
 
@@ -139,6 +165,7 @@ class Collection implements CollectionInterface
      */
     public function exists(string $id, ?ExistsOptions $options = null): ExistsResult
     {
+        $this->flushPendingOperations();
         $response = Extension\documentExists(
             $this->core,
             $this->bucketName,
@@ -166,6 +193,8 @@ class Collection implements CollectionInterface
      */
     public function getAndLock(string $id, int $lockTimeSeconds, ?GetAndLockOptions $options = null): GetResult
     {
+        $this->flushPendingOperations();
+        $this->invalidateReadCache($id);
         $response = Extension\documentGetAndLock(
             $this->core,
             $this->bucketName,
@@ -193,6 +222,8 @@ class Collection implements CollectionInterface
      */
     public function getAndTouch(string $id, $expiry, ?GetAndTouchOptions $options = null): GetResult
     {
+        $this->flushPendingOperations();
+        $this->invalidateReadCache($id);
         if ($expiry instanceof DateTimeInterface) {
             $expirySeconds = $expiry->getTimestamp();
         } else {
@@ -225,6 +256,7 @@ class Collection implements CollectionInterface
      */
     public function getAnyReplica(string $id, ?GetAnyReplicaOptions $options = null): GetReplicaResult
     {
+        $this->flushPendingOperations();
         $response = Extension\documentGetAnyReplica(
             $this->core,
             $this->bucketName,
@@ -250,6 +282,7 @@ class Collection implements CollectionInterface
      */
     public function getAllReplicas(string $id, ?GetAllReplicasOptions $options = null): array
     {
+        $this->flushPendingOperations();
         $responses = Extension\documentGetAllReplicas(
             $this->core,
             $this->bucketName,
@@ -280,6 +313,11 @@ class Collection implements CollectionInterface
      */
     public function upsert(string $id, $value, ?UpsertOptions $options = null): MutationResult
     {
+        $this->invalidateReadCache($id);
+        if (FiberScheduler::inManagedFiber()) {
+            return FiberScheduler::await($this->upsertAsync($id, $value, $options));
+        }
+        $this->flushPendingOperations();
         $encoded = UpsertOptions::encodeDocument($options, $value);
         $response = Extension\documentUpsert(
             $this->core,
@@ -309,6 +347,8 @@ class Collection implements CollectionInterface
      */
     public function insert(string $id, $value, ?InsertOptions $options = null): MutationResult
     {
+        $this->flushPendingOperations();
+        $this->invalidateReadCache($id);
         $encoded = InsertOptions::encodeDocument($options, $value);
         $response = Extension\documentInsert(
             $this->core,
@@ -339,6 +379,8 @@ class Collection implements CollectionInterface
      */
     public function replace(string $id, $value, ?ReplaceOptions $options = null): MutationResult
     {
+        $this->flushPendingOperations();
+        $this->invalidateReadCache($id);
         $encoded = ReplaceOptions::encodeDocument($options, $value);
         $response = Extension\documentReplace(
             $this->core,
@@ -368,6 +410,11 @@ class Collection implements CollectionInterface
      */
     public function remove(string $id, ?RemoveOptions $options = null): MutationResult
     {
+        $this->invalidateReadCache($id);
+        if (FiberScheduler::inManagedFiber()) {
+            return FiberScheduler::await($this->removeAsync($id, $options));
+        }
+        $this->flushPendingOperations();
         $response = Extension\documentRemove(
             $this->core,
             $this->bucketName,
@@ -396,6 +443,8 @@ class Collection implements CollectionInterface
      */
     public function unlock(string $id, string $cas, ?UnlockOptions $options = null): Result
     {
+        $this->flushPendingOperations();
+        $this->invalidateReadCache($id);
         $response = Extension\documentUnlock(
             $this->core,
             $this->bucketName,
@@ -423,6 +472,8 @@ class Collection implements CollectionInterface
      */
     public function touch(string $id, $expiry, ?TouchOptions $options = null): MutationResult
     {
+        $this->flushPendingOperations();
+        $this->invalidateReadCache($id);
         if ($expiry instanceof DateTimeInterface) {
             $expirySeconds = $expiry->getTimestamp();
         } else {
@@ -444,7 +495,7 @@ class Collection implements CollectionInterface
      * Performs a set of subdocument lookup operations against the document.
      *
      * @param string $id the key of the document
-     * @param array<LookupInSpec> $specs the array of selectors to query against the document
+     * @param array<LookupInSpec>|PreparedLookupInSpecs $specs the array of selectors to query against the document
      * @param LookupInOptions|null $options the options to use for the operation
      *
      * @return LookupInResult
@@ -453,14 +504,19 @@ class Collection implements CollectionInterface
      * @throws CouchbaseException
      * @since 4.0.0
      */
-    public function lookupIn(string $id, array $specs, ?LookupInOptions $options = null): LookupInResult
+    public function lookupIn(string $id, array|PreparedLookupInSpecs $specs, ?LookupInOptions $options = null): LookupInResult
     {
-        $encoded = array_map(
-            function (LookupInSpec $item) {
-                return $item->export();
-            },
-            $specs
-        );
+        $this->flushPendingOperations();
+        if ($specs instanceof PreparedLookupInSpecs) {
+            $encoded = $specs->export();
+        } else {
+            $encoded = array_map(
+                function (LookupInSpec $item) {
+                    return $item->export();
+                },
+                $specs
+            );
+        }
         if ($options != null && $options->needToFetchExpiry()) {
             $encoded[] = ['opcode' => 'get', 'isXattr' => true, 'path' => LookupInMacro::EXPIRY_TIME];
         }
@@ -491,6 +547,7 @@ class Collection implements CollectionInterface
      */
     public function lookupInAnyReplica(string $id, array $specs, ?LookupInAnyReplicaOptions $options = null): LookupInReplicaResult
     {
+        $this->flushPendingOperations();
         $encoded = array_map(
             function (LookupInSpec $item) {
                 return $item->export();
@@ -528,6 +585,7 @@ class Collection implements CollectionInterface
      */
     public function lookupInAllReplicas(string $id, array $specs, ?LookupInAllReplicasOptions $options = null): array
     {
+        $this->flushPendingOperations();
         $encoded = array_map(
             function (LookupInSpec $item) {
                 return $item->export();
@@ -558,7 +616,7 @@ class Collection implements CollectionInterface
      * Performs a set of subdocument lookup operations against the document.
      *
      * @param string $id the key of the document
-     * @param array<MutateInSpec> $specs the array of modifications to perform against the document
+     * @param array<MutateInSpec>|PreparedMutateInSpecs $specs the array of modifications to perform against the document
      * @param MutateInOptions|null $options the options to use for the operation
      *
      * @return MutateInResult
@@ -568,14 +626,20 @@ class Collection implements CollectionInterface
      * @throws CouchbaseException
      * @since 4.0.0
      */
-    public function mutateIn(string $id, array $specs, ?MutateInOptions $options = null): MutateInResult
+    public function mutateIn(string $id, array|PreparedMutateInSpecs $specs, ?MutateInOptions $options = null): MutateInResult
     {
-        $encoded = array_map(
-            function (MutateInSpec $item) use ($options) {
-                return $item->export($options);
-            },
-            $specs
-        );
+        $this->flushPendingOperations();
+        $this->invalidateReadCache($id);
+        if ($specs instanceof PreparedMutateInSpecs) {
+            $encoded = $specs->export($options);
+        } else {
+            $encoded = array_map(
+                function (MutateInSpec $item) use ($options) {
+                    return $item->export($options);
+                },
+                $specs
+            );
+        }
         $response = Extension\documentMutateIn(
             $this->core,
             $this->bucketName,
@@ -600,14 +664,11 @@ class Collection implements CollectionInterface
      */
     public function getMulti(array $ids, ?GetOptions $options = null): array
     {
-        $responses = Extension\documentGetMulti(
-            $this->core,
-            $this->bucketName,
-            $this->scopeName,
-            $this->name,
-            $ids,
-            GetOptions::export($options)
-        );
+        $this->flushPendingOperations();
+        if ($this->readCache != null && GetOptions::isReadCacheable($options)) {
+            return $this->getMultiCached($ids, $options);
+        }
+        $responses = $this->fetchMulti($ids, GetOptions::export($options));
         return array_map(
             function (array $response) use ($options) {
                 return new GetResult($response, GetOptions::getTranscoder($options));
@@ -632,6 +693,7 @@ class Collection implements CollectionInterface
      */
     public function scan(ScanType $scanType, ?ScanOptions $options = null): ScanResults
     {
+        $this->flushPendingOperations();
         if ($scanType instanceof RangeScan) {
             $type = RangeScan::export($scanType);
         } elseif ($scanType instanceof SamplingScan) {
@@ -648,7 +710,8 @@ class Collection implements CollectionInterface
             $this->name,
             $type,
             ScanOptions::export($options),
-            ScanOptions::getTranscoder($options)
+            ScanOptions::getTranscoder($options),
+            ScanOptions::getRawItems($options)
         );
     }
 
@@ -666,13 +729,24 @@ class Collection implements CollectionInterface
      */
     public function removeMulti(array $entries, ?RemoveOptions $options = null): array
     {
-        $responses = Extension\documentRemoveMulti(
-            $this->core,
-            $this->bucketName,
-            $this->scopeName,
-            $this->name,
+        $this->flushPendingOperations();
+        foreach ($entries as $entry) {
+            $this->invalidateReadCache(is_array($entry) ? $entry[0] : $entry);
+        }
+        $exportedOptions = RemoveOptions::export($options);
+        $responses = AdaptiveWindow::dispatch(
             $entries,
-            RemoveOptions::export($options)
+            RemoveOptions::getMaxInFlight($options),
+            function (array $window) use ($exportedOptions) {
+                return Extension\documentRemoveMulti(
+                    $this->core,
+                    $this->bucketName,
+                    $this->scopeName,
+                    $this->name,
+                    $window,
+                    $exportedOptions
+                );
+            }
         );
         return array_map(
             function (array $response) {
@@ -695,39 +769,482 @@ class Collection implements CollectionInterface
      */
     public function upsertMulti(array $entries, ?UpsertOptions $options = null): array
     {
-        $encodedEntries = array_map(
-            function (array $entry) use ($options) {
-                if (count($entry) != 2) {
-                    throw new InvalidArgumentException("expected ID-VALUE tuple to have exactly 2 entries");
+        $this->flushPendingOperations();
+        $encodedEntries = [];
+        foreach ($entries as $key => $entry) {
+            if (count($entry) != 2) {
+                throw new InvalidArgumentException("expected ID-VALUE tuple to have exactly 2 entries");
+            }
+            if (!is_string($entry[0])) {
+                throw new InvalidArgumentException("expected first entry (ID) of ID-VALUE tuple to be a string");
+            }
+            $this->invalidateReadCache($entry[0]);
+            // for raw transcoders the value is passed through as is, PHP shares the string instead of copying it
+            $encoded = UpsertOptions::encodeDocument($options, $entry[1]);
+            $encodedEntries[$key] = [
+                $entry[0],   // id
+                $encoded[0], // value
+                $encoded[1], // flags
+            ];
+        }
+        $exportedOptions = UpsertOptions::export($options);
+        $responses = AdaptiveWindow::dispatch(
+            $encodedEntries,
+            UpsertOptions::getMaxInFlight($options),
+            function (array $window) use ($exportedOptions) {
+                return Extension\documentUpsertMulti(
+                    $this->core,
+                    $this->bucketName,
+                    $this->scopeName,
+                    $this->name,
+                    $window,
+                    $exportedOptions
+                );
+            }
+        );
+        return array_map(
+            function (array $response) {
+                return new MutationResult($response);
+            },
+            $responses
+        );
+    }
+
+    /**
+     * Loads documents from the source, which might be a generator, in bounded windows. Documents failed with
+     * temporary errors or timeouts are retried with backoff, and only the documents that still fail are reported
+     * in the result. The memory used does not depend on the number of documents in the source.
+     *
+     * The keys of the source must be strings. A list without keys is rejected rather than stored under its
+     * positions. Note that PHP turns numeric string keys of arrays into integers, so such IDs have to be yielded
+     * by a generator.
+     *
+     * @param iterable $source document contents keyed by document ID
+     * @param BulkOptions|null $options the options to use for the operation
+     *
+     * @return BulkResult
+     * @throws InvalidArgumentException
+     * @since 4.2.5
+     */
+    public function bulkUpsert(iterable $source, ?BulkOptions $options = null): BulkResult
+    {
+        $this->flushPendingOperations();
+        $upsertOptions = BulkOptions::getUpsertOptions($options);
+        $exportedOptions = BulkOptions::export($options);
+        $progressCallback = BulkOptions::getProgressCallback($options);
+        $window = new AdaptiveWindow($exportedOptions['windowSize']);
+        $result = new BulkResult();
+        $entries = [];
+        foreach ($source as $id => $value) {
+            if (!is_string($id)) {
+                throw new InvalidArgumentException(
+                    sprintf("Document ID must be a string, %s given in the bulk source", gettype($id))
+                );
+            }
+            $this->invalidateReadCache($id);
+            $encoded = UpsertOptions::encodeDocument($upsertOptions, $value);
+            $entries[] = [$id, $encoded[0], $encoded[1]];
+            if (count($entries) >= $window->size()) {
+                $this->bulkUpsertWindow($entries, $upsertOptions, $exportedOptions, $window, $result);
+                $entries = [];
+                if ($progressCallback != null) {
+                    $progressCallback($result);
                 }
-                if (!is_string($entry[0])) {
-                    throw new InvalidArgumentException("expected first entry (ID) of ID-VALUE tuple to be a string");
+            }
+        }
+        if (count($entries) > 0) {
+            $this->bulkUpsertWindow($entries, $upsertOptions, $exportedOptions, $window, $result);
+            if ($progressCallback != null) {
+                $progressCallback($result);
+            }
+        }
+        return $result;
+    }
+
+    /**
+     * Starts fetching a document from the server without waiting for the response.
+     *
+     * Consecutive gets with the same options are sent to the server together in a single multi-operation call.
+     * See upsertAsync() for when the operations are sent.
+     *
+     * @param string $id the key of the document to fetch
+     * @param GetOptions|null $options the options to use for the operation
+     *
+     * @return PendingResult handle resolving to GetResult
+     * @see PendingResult::wait()
+     * @since 4.2.5
+     */
+    public function getAsync(string $id, ?GetOptions $options = null): PendingResult
+    {
+        return $this->startGet($id, $options, false);
+    }
+
+    /**
+     * Enqueues the get into the pending batch.
+     *
+     * @param string $id the key of the document to fetch
+     * @param GetOptions|null $options the options to use for the operation
+     * @param bool $cacheable whether the responses should be stored in the read cache
+     *
+     * @return PendingResult
+     */
+    private function startGet(string $id, ?GetOptions $options, bool $cacheable): PendingResult
+    {
+        $exportedOptions = $cacheable ? GetOptions::exportForReadCache($options) : GetOptions::export($options);
+        $transcoder = GetOptions::getTranscoder($options);
+        $batch = $this->pendingBatch(
+            sprintf("get--%d--%s", spl_object_id($transcoder), serialize($exportedOptions)),
+            function (array $ids) use ($exportedOptions, $transcoder, $cacheable) {
+                $responses = $this->fetchMulti($ids, $exportedOptions);
+                if ($cacheable) {
+                    foreach ($responses as $index => $response) {
+                        $this->readCache->put(
+                            ReadCache::key($this->bucketName, $this->scopeName, $this->name, (string)$ids[$index]),
+                            $response
+                        );
+                    }
                 }
-                $encoded = UpsertOptions::encodeDocument($options, $entry[1]);
-                return [
-                    $entry[0],   // id
-                    $encoded[0], // value
-                    $encoded[1], // flags
-                ];
+                return array_map(
+                    function (array $response) use ($transcoder) {
+                        return new GetResult($response, $transcoder);
+                    },
+                    $responses
+                );
+            }
+        );
+        return $batch->enqueue($id, $id, true);
+    }
+
+    /**
+     * Starts creating or updating a document without waiting for the response.
+     *
+     * The value is encoded immediately, and consecutive upserts with the same options are sent to the server
+     * together in a single multi-operation call.
+     *
+     * The asynchronous operations of the collection are sent in the order they have been started: the pending
+     * group is sent when any of its operations is waited on, and before another kind of operation (or the same
+     * kind with other options), a second write of the same document, or any synchronous operation of the
+     * collection is issued. Operations of a BinaryCollection obtained before the asynchronous operation was
+     * started are not ordered against it. An operation which is never waited on and is not followed by another
+     * operation of the collection is never sent, so wait on the handles, e.g. with Cluster::waitAll().
+     *
+     * @param string $id the key of the document
+     * @param mixed $value the value to use for the document
+     * @param UpsertOptions|null $options the options to use for the operation
+     *
+     * @return PendingResult handle resolving to MutationResult
+     * @see PendingResult::wait()
+     * @since 4.2.5
+     */
+    public function upsertAsync(string $id, $value, ?UpsertOptions $options = null): PendingResult
+    {
+        $this->invalidateReadCache($id);
+        $exportedOptions = UpsertOptions::export($options);
+        $batch = $this->pendingBatch(
+            sprintf("upsert--%s", serialize($exportedOptions)),
+            function (array $entries) use ($exportedOptions) {
+                $responses = Extension\documentUpsertMulti(
+                    $this->core,
+                    $this->bucketName,
+                    $this->scopeName,
+                    $this->name,
+                    $entries,
+                    $exportedOptions
+                );
+                // a get issued while the upsert was queued might have cached the old content
+                foreach ($entries as $entry) {
+                    $this->invalidateReadCache($entry[0]);
+                }
+                return array_map(
+                    function (array $response) {
+                        return new MutationResult($response);
+                    },
+                    $responses
+                );
+            },
+            $id
+        );
+        $encoded = UpsertOptions::encodeDocument($options, $value);
+        return $batch->enqueue([$id, $encoded[0], $encoded[1]], $id);
+    }
+
+    /**
+     * Starts removing a document without waiting for the response.
+     *
+     * Consecutive removals with the same options are sent to the server together in a single multi-operation
+     * call. See upsertAsync() for when the operations are sent.
+     *
+     * @param string $id the key of the document
+     * @param RemoveOptions|null $options the options to use for the operation
+     *
+     * @return PendingResult handle resolving to MutationResult
+     * @see PendingResult::wait()
+     * @since 4.2.5
+     */
+    public function removeAsync(string $id, ?RemoveOptions $options = null): PendingResult
+    {
+        $this->invalidateReadCache($id);
+        $exportedOptions = RemoveOptions::export($options);
+        $batch = $this->pendingBatch(
+            sprintf("remove--%s", serialize($exportedOptions)),
+            function (array $ids) use ($exportedOptions) {
+                $responses = Extension\documentRemoveMulti(
+                    $this->core,
+                    $this->bucketName,
+                    $this->scopeName,
+                    $this->name,
+                    $ids,
+                    $exportedOptions
+                );
+                // a get issued while the removal was queued might have cached the old content
+                foreach ($ids as $id) {
+                    $this->invalidateReadCache($id);
+                }
+                return array_map(
+                    function (array $response) {
+                        return new MutationResult($response);
+                    },
+                    $responses
+                );
+            },
+            $id
+        );
+        return $batch->enqueue($id, $id);
+    }
+
+    /**
+     * Sends one window of the bulk load, and retries the entries that failed with temporary errors.
+     *
+     * @param array $entries encoded ID-VALUE-FLAGS tuples
+     * @param UpsertOptions|null $upsertOptions
+     * @param array $bulkOptions exported BulkOptions
+     * @param AdaptiveWindow $window
+     * @param BulkResult $result
+     */
+    private function bulkUpsertWindow(
+        array $entries,
+        ?UpsertOptions $upsertOptions,
+        array $bulkOptions,
+        AdaptiveWindow $window,
+        BulkResult $result
+    ): void
+    {
+        $exportedOptions = UpsertOptions::export($upsertOptions);
+        for ($attempt = 0; count($entries) > 0; ++$attempt) {
+            if ($attempt > 0) {
+                usleep(Backoff::delay($bulkOptions['retryBackoff'] * 1000, $bulkOptions['maxRetryBackoff'] * 1000, $attempt - 1, false));
+            }
+            $responses = Extension\documentUpsertMulti(
+                $this->core,
+                $this->bucketName,
+                $this->scopeName,
+                $this->name,
+                $entries,
+                $exportedOptions
+            );
+            // the source generator might have read the documents while the window was being filled
+            foreach ($entries as $entry) {
+                $this->invalidateReadCache($entry[0]);
+            }
+            $window->record($responses);
+            $retries = [];
+            foreach (array_values($responses) as $index => $response) {
+                $error = $response["error"] ?? null;
+                if ($error == null) {
+                    $result->recordSuccess();
+                } elseif (
+                    $attempt < $bulkOptions['maxRetries'] &&
+                    ($error instanceof TimeoutException || $error instanceof TemporaryFailureException)
+                ) {
+                    $result->recordRetry();
+                    $retries[] = $entries[$index];
+                } else {
+                    $result->recordFailure($entries[$index][0], $error);
+                }
+            }
+            $entries = $retries;
+        }
+    }
+
+    /**
+     * Reads the document from the active node with a short timeout, and from the fastest replica if the active
+     * node does not respond in time.
+     *
+     * @param string $id
+     * @param array $exportedOptions options for the read from the active node
+     * @param GetAnyReplicaOptions $replicaOptions options for the read from the replicas
+     * @param bool $cacheable whether the response of the active node can be stored in the read cache
+     *
+     * @return GetResult
+     * @throws CouchbaseException
+     */
+    private function getWithReplicaFallback(
+        string $id,
+        array $exportedOptions,
+        GetAnyReplicaOptions $replicaOptions,
+        bool $cacheable
+    ): GetResult
+    {
+        if ($cacheable) {
+            // the expiry allows the read cache to drop the document when it expires
+            $exportedOptions['withExpiry'] = true;
+        }
+        try {
+            $response = Extension\documentGet(
+                $this->core,
+                $this->bucketName,
+                $this->scopeName,
+                $this->name,
+                $id,
+                $exportedOptions
+            );
+        } catch (TimeoutException $exception) {
+            $response = Extension\documentGetAnyReplica(
+                $this->core,
+                $this->bucketName,
+                $this->scopeName,
+                $this->name,
+                $id,
+                GetAnyReplicaOptions::export($replicaOptions)
+            );
+            // replicas might lag behind the active node, so their responses never go to the read cache
+            return new GetResult($response, GetAnyReplicaOptions::getTranscoder($replicaOptions));
+        }
+        if ($cacheable) {
+            $this->readCache->put(ReadCache::key($this->bucketName, $this->scopeName, $this->name, $id), $response);
+        }
+        return new GetResult($response, GetAnyReplicaOptions::getTranscoder($replicaOptions));
+    }
+
+    /**
+     * Serves the documents from the read cache, and fetches only missing ones with a single multi-operation call.
+     *
+     * @param array $ids
+     * @param GetOptions|null $options
+     *
+     * @return array<GetResult>
+     */
+    private function getMultiCached(array $ids, ?GetOptions $options): array
+    {
+        $responses = [];
+        $missing = [];
+        foreach ($ids as $index => $id) {
+            $response = GetOptions::bypassesReadCache($options)
+                ? null
+                : $this->readCache->get(ReadCache::key($this->bucketName, $this->scopeName, $this->name, (string)$id));
+            if ($response == null) {
+                $missing[$index] = $id;
+            }
+            $responses[$index] = $response;
+        }
+        if (count($missing) > 0) {
+            $fetched = $this->fetchMulti($missing, GetOptions::exportForReadCache($options));
+            foreach ($fetched as $index => $response) {
+                $responses[$index] = $response;
+                $this->readCache->put(
+                    ReadCache::key($this->bucketName, $this->scopeName, $this->name, (string)$missing[$index]),
+                    $response
+                );
+            }
+        }
+        $transcoder = GetOptions::getTranscoder($options);
+        return array_map(
+            function (array $response) use ($transcoder) {
+                return new GetResult($response, $transcoder);
+            },
+            $responses
+        );
+    }
+
+    /**
+     * Fetches the documents with a single multi-operation call. Duplicate ids are sent to the server only once,
+     * and all their entries receive the same response.
+     *
+     * @param array $ids
+     * @param array $exportedOptions
+     *
+     * @return array raw responses with the same keys as the array of ids
+     */
+    private function fetchMulti(array $ids, array $exportedOptions): array
+    {
+        $uniqueIds = array_map(
+            function ($id) {
+                return (string)$id;
             },
-            $entries
+            array_values(array_unique($ids))
         );
-        $responses = Extension\documentUpsertMulti(
+        $responses = Extension\documentGetMulti(
             $this->core,
             $this->bucketName,
             $this->scopeName,
             $this->name,
-            $encodedEntries,
-            UpsertOptions::export($options)
+            $uniqueIds,
+            $exportedOptions
         );
+        if (count($uniqueIds) == count($ids)) {
+            return array_combine(array_keys($ids), array_values($responses));
+        }
+        $responsesById = array_combine($uniqueIds, array_values($responses));
         return array_map(
-            function (array $response) {
-                return new MutationResult($response);
+            function ($id) use ($responsesById) {
+                return $responsesById[(string)$id];
             },
-            $responses
+            $ids
         );
     }
 
+    /**
+     * Drops the document from the read caches of the process, when it gets modified.
+     *
+     * @param string $id
+     */
+    private function invalidateReadCache(string $id): void
+    {
+        ReadCache::invalidateDocument($this->bucketName, $this->scopeName, $this->name, $id);
+    }
+
+    /**
+     * Returns the batch which is still accepting operations for the given group, or starts a new one.
+     *
+     * Only one batch of the collection accepts operations at a time. The batch is sent before an operation of
+     * another group, a second write of the same document, or any synchronous operation is issued, so that
+     * the operations reach the server in the order they have been started.
+     *
+     * @param string $group the key that identifies kind of the operation and its options
+     * @param callable $dispatcher the function that sends the whole batch to the server
+     * @param string|null $writtenId the key of the document the operation modifies, or null for reads
+     *
+     * @return PendingOperationBatch
+     */
+    private function pendingBatch(string $group, callable $dispatcher, ?string $writtenId = null): PendingOperationBatch
+    {
+        if (
+            $this->pendingBatch != null &&
+            ($this->pendingGroup !== $group || ($writtenId !== null && $this->pendingBatch->contains($writtenId)))
+        ) {
+            $this->flushPendingOperations();
+        }
+        if ($this->pendingBatch == null || $this->pendingBatch->isDispatched()) {
+            $this->pendingGroup = $group;
+            $this->pendingBatch = new PendingOperationBatch($dispatcher);
+        }
+        return $this->pendingBatch;
+    }
+
+    /**
+     * Sends the operations which have been started asynchronously and are still waiting in the batch.
+     */
+    private function flushPendingOperations(): void
+    {
+        if ($this->pendingBatch == null) {
+            return;
+        }
+        $batch = $this->pendingBatch;
+        $this->pendingGroup = null;
+        $this->pendingBatch = null;
+        $batch->dispatch();
+    }
+
     /**
      * Creates and returns a BinaryCollection object for use with binary type documents.
      *
@@ -736,6 +1253,7 @@ class Collection implements CollectionInterface
      */
     public function binary(): BinaryCollection
     {
+        $this->flushPendingOperations();
         return new BinaryCollection($this->name, $this->scopeName, $this->bucketName, $this->core);
     }
 
@@ -22,6 +22,13 @@ namespace Couchbase;
 
 interface CollectionInterface
 {
+    /**
+     * Maximum number of paths the server accepts in a single lookupIn() or mutateIn() operation.
+     *
+     * @since 4.2.5
+     */
+    public const MAX_SPECS_PER_OPERATION = 16;
+
     public function bucketName(): string;
 
     public function scopeName(): string;
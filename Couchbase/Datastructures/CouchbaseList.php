@@ -224,6 +224,59 @@ class CouchbaseList implements Countable, IteratorAggregate, ArrayAccess
         );
     }
 
+    /**
+     * Retrieves up to 16 consecutive entries using single subdocument lookup.
+     *
+     * @param int $offset offset of the first entry
+     * @param int $length number of entries to retrieve
+     *
+     * @return array the entries, fewer than requested if the list ends earlier
+     * @throws InvalidArgumentException
+     * @since 4.2.5
+     */
+    public function slice(int $offset, int $length): array
+    {
+        if ($length < 1 || $length > CollectionInterface::MAX_SPECS_PER_OPERATION) {
+            throw new InvalidArgumentException(
+                sprintf("Slice length must be between 1 and %d", CollectionInterface::MAX_SPECS_PER_OPERATION)
+            );
+        }
+        $specs = [];
+        for ($index = $offset; $index < $offset + $length; ++$index) {
+            $specs[] = new LookupGetSpec(sprintf("[%d]", $index));
+        }
+        try {
+            $result = $this->collection->lookupIn($this->id, $specs, $this->options->lookupInOptions());
+        } catch (DocumentNotFoundException $ex) {
+            return [];
+        }
+        $values = [];
+        for ($index = 0; $index < $length && $result->exists($index); ++$index) {
+            $values[] = $result->content($index);
+        }
+        return $values;
+    }
+
+    /**
+     * Walks through the list reading it in slices, so that the whole document is never transferred at once.
+     *
+     * @param int $pageSize number of entries to read per round trip (at most 16)
+     *
+     * @return Traversable iterator to enumerate elements of the list
+     * @throws InvalidArgumentException
+     * @since 4.2.5
+     */
+    public function paged(int $pageSize = CollectionInterface::MAX_SPECS_PER_OPERATION): Traversable
+    {
+        $offset = 0;
+        do {
+            $values = $this->slice($offset, $pageSize);
+            foreach ($values as $value) {
+                yield $offset++ => $value;
+            }
+        } while (count($values) == $pageSize);
+    }
+
     /**
      * Checks whether an offset exists.
      *
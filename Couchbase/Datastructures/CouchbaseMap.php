@@ -139,6 +139,30 @@ class CouchbaseMap implements Countable, IteratorAggregate, ArrayAccess
         );
     }
 
+    /**
+     * Insert or update several keys at once.
+     *
+     * Every 16 entries are written using single subdocument mutation. Each such mutation is atomic, but the batch
+     * as a whole is not.
+     *
+     * @param array<string, mixed> $entries new values keyed by the map key
+     *
+     * @throws InvalidArgumentException
+     * @since 4.2.5
+     */
+    public function setMany(array $entries): void
+    {
+        $options = clone $this->options->mutateInOptions();
+        $options->storeSemantics(StoreSemantics::UPSERT);
+        foreach (array_chunk($entries, CollectionInterface::MAX_SPECS_PER_OPERATION, true) as $chunk) {
+            $specs = [];
+            foreach ($chunk as $key => $value) {
+                $specs[] = new MutateUpsertSpec((string)$key, $value, false, false, false);
+            }
+            $this->collection->mutateIn($this->id, $specs, $options);
+        }
+    }
+
     /**
      * Remove entry by its key.
      *
@@ -124,6 +124,46 @@ class CouchbaseQueue implements Countable, IteratorAggregate
         }
     }
 
+    /**
+     * Pop several entries from the FIFO queue, using one lookup and one mutation regardless of the number of entries.
+     *
+     * @param int $count maximum number of entries to pop (at most 16)
+     *
+     * @return array the oldest values in the queue, in the order they would be returned by pop()
+     * @throws InvalidArgumentException
+     * @since 4.2.5
+     */
+    public function popMany(int $count): array
+    {
+        if ($count < 1 || $count > CollectionInterface::MAX_SPECS_PER_OPERATION) {
+            throw new InvalidArgumentException(
+                sprintf("Number of entries must be between 1 and %d", CollectionInterface::MAX_SPECS_PER_OPERATION)
+            );
+        }
+        $specs = [];
+        for ($index = 1; $index <= $count; ++$index) {
+            $specs[] = new LookupGetSpec(sprintf("[-%d]", $index), false);
+        }
+        try {
+            $result = $this->collection->lookupIn($this->id, $specs, $this->options->lookupInOptions());
+            $values = [];
+            $removeSpecs = [];
+            for ($index = 0; $index < $count && $result->exists($index); ++$index) {
+                $values[] = $result->content($index);
+                $removeSpecs[] = new MutateRemoveSpec("[-1]", false);
+            }
+            if (count($values) == 0) {
+                return [];
+            }
+            $options = clone $this->options->mutateInOptions();
+            $options->cas($result->cas());
+            $this->collection->mutateIn($this->id, $removeSpecs, $options);
+            return $values;
+        } catch (DocumentNotFoundException | PathNotFoundException $ex) {
+            return [];
+        }
+    }
+
     /**
      * Enqueue new value to the FIFO queue
      *
@@ -143,6 +183,28 @@ class CouchbaseQueue implements Countable, IteratorAggregate
         );
     }
 
+    /**
+     * Enqueue several values to the FIFO queue using single subdocument mutation.
+     *
+     * @param array $values the values to insert, the first one will be popped first
+     *
+     * @throws InvalidArgumentException
+     * @since 4.2.5
+     */
+    public function pushMany(array $values): void
+    {
+        if (count($values) == 0) {
+            return;
+        }
+        $options = clone $this->options->mutateInOptions();
+        $options->storeSemantics(StoreSemantics::UPSERT);
+        $this->collection->mutateIn(
+            $this->id,
+            [new MutateArrayPrependSpec("", array_reverse(array_values($values)), false, false, false)],
+            $options
+        );
+    }
+
     /**
      * Clears the queue. Effectively it removes backing document, because missing document is an equivalent of the
      * empty collection.
@@ -22,11 +22,14 @@ namespace Couchbase\Datastructures;
 
 use ArrayIterator;
 use Couchbase\CollectionInterface;
+use Couchbase\Exception\CasMismatchException;
+use Couchbase\Exception\DocumentExistsException;
 use Couchbase\Exception\DocumentNotFoundException;
 use Couchbase\Exception\InvalidArgumentException;
 use Couchbase\Exception\PathExistsException;
 use Couchbase\LookupCountSpec;
 use Couchbase\MutateArrayAddUniqueSpec;
+use Couchbase\MutateArrayAppendSpec;
 use Couchbase\MutateRemoveSpec;
 use Couchbase\StoreSemantics;
 use Countable;
@@ -140,6 +143,46 @@ class CouchbaseSet implements Countable, IteratorAggregate
         }
     }
 
+    /**
+     * Adds several values to the set.
+     *
+     * Instead of one mutation per value, the current content is read once, and all values not yet in the set are
+     * appended using single subdocument mutation guarded by CAS.
+     *
+     * @param array $values the values to insert
+     *
+     * @throws CasMismatchException if the set has been modified concurrently
+     * @throws DocumentExistsException if the set has been created concurrently
+     * @throws InvalidArgumentException
+     * @since 4.2.5
+     */
+    public function addMany(array $values): void
+    {
+        $options = clone $this->options->mutateInOptions();
+        try {
+            $result = $this->collection->get($this->id, $this->options->getOptions());
+            $existing = $result->content() ?: [];
+            $options->cas($result->cas());
+        } catch (DocumentNotFoundException $ex) {
+            $existing = [];
+            $options->storeSemantics(StoreSemantics::INSERT);
+        }
+        $missing = [];
+        foreach ($values as $value) {
+            if (!in_array($value, $existing, true) && !in_array($value, $missing, true)) {
+                $missing[] = $value;
+            }
+        }
+        if (count($missing) == 0) {
+            return;
+        }
+        $this->collection->mutateIn(
+            $this->id,
+            [new MutateArrayAppendSpec("", $missing, false, false, false)],
+            $options
+        );
+    }
+
     /**
      * Checks whether an offset exists.
      *
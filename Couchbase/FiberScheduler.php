@@ -0,0 +1,160 @@
+<?php
+
+/**
+ * Copyright 2014-Present Couchbase, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+declare(strict_types=1);
+
+namespace Couchbase;
+
+use Couchbase\Exception\CouchbaseException;
+use Fiber;
+use Throwable;
+
+/**
+ * FiberScheduler runs tasks in separate fibers, so that ordinary sequential key-value calls made by the tasks
+ * overlap with each other.
+ *
+ * Inside the fibers started by the scheduler, Collection::get(), Collection::upsert() and Collection::remove()
+ * do not block, but queue the operation and suspend the fiber. Once every task is either suspended or finished,
+ * the scheduler sends all queued operations to the server, grouped into multi-operations, and resumes the fibers
+ * with their results (or throws the exception into the fiber, like the blocking call would).
+ *
+ * <code>
+ * $results = FiberScheduler::run([
+ *     'a' => function () use ($collection) { return $collection->get('a')->content(); },
+ *     'b' => function () use ($collection) { return $collection->get('b')->content(); },
+ * ]);
+ * </code>
+ *
+ * Fibers created by the application itself are not affected, and calling Fiber::suspend() without value inside
+ * the task acts as a plain yield point.
+ *
+ * @since 4.2.5
+ */
+class FiberScheduler
+{
+    /**
+     * @var array<int, bool> ids of the fibers managed by the running schedulers
+     */
+    private static array $managedFibers = [];
+
+    /**
+     * Runs the tasks until all of them complete. If any task throws, the exception is propagated to the caller
+     * and the remaining tasks are abandoned.
+     *
+     * @param array<callable> $tasks
+     *
+     * @return array values returned by the tasks, with the same keys as the input array
+     * @throws Throwable
+     * @since 4.2.5
+     */
+    public static function run(array $tasks): array
+    {
+        $fibers = [];
+        foreach ($tasks as $key => $task) {
+            $fiber = new Fiber($task);
+            self::$managedFibers[spl_object_id($fiber)] = true;
+            $fibers[$key] = $fiber;
+        }
+        try {
+            $suspended = [];
+            foreach ($fibers as $key => $fiber) {
+                $awaited = $fiber->start();
+                if (!$fiber->isTerminated()) {
+                    $suspended[$key] = $awaited;
+                }
+            }
+            while (count($suspended) > 0) {
+                foreach ($suspended as $awaited) {
+                    if ($awaited instanceof PendingResult) {
+                        $awaited->dispatch();
+                    }
+                }
+                $stillSuspended = [];
+                foreach ($suspended as $key => $awaited) {
+                    $fiber = $fibers[$key];
+                    $awaited = self::resume($fiber, $awaited);
+                    if (!$fiber->isTerminated()) {
+                        $stillSuspended[$key] = $awaited;
+                    }
+                }
+                $suspended = $stillSuspended;
+            }
+            return array_map(
+                function (Fiber $fiber) {
+                    return $fiber->getReturn();
+                },
+                $fibers
+            );
+        } finally {
+            foreach ($fibers as $fiber) {
+                unset(self::$managedFibers[spl_object_id($fiber)]);
+            }
+        }
+    }
+
+    /**
+     * @return bool true if the code is executed by one of the fibers of the running scheduler
+     * @internal
+     *
+     * @since 4.2.5
+     */
+    public static function inManagedFiber(): bool
+    {
+        $fiber = Fiber::getCurrent();
+        return $fiber !== null && array_key_exists(spl_object_id($fiber), self::$managedFibers);
+    }
+
+    /**
+     * Suspends the current fiber until the scheduler resolves the operation.
+     *
+     * @param PendingResult $pendingResult
+     *
+     * @return Result
+     * @throws CouchbaseException
+     * @internal
+     *
+     * @since 4.2.5
+     */
+    public static function await(PendingResult $pendingResult): Result
+    {
+        if (!self::inManagedFiber()) {
+            return $pendingResult->wait();
+        }
+        return Fiber::suspend($pendingResult);
+    }
+
+    /**
+     * @param Fiber $fiber
+     * @param mixed $awaited the value the fiber was suspended with
+     *
+     * @return mixed the value of the next suspension
+     * @throws Throwable
+     */
+    private static function resume(Fiber $fiber, $awaited)
+    {
+        if (!($awaited instanceof PendingResult)) {
+            return $fiber->resume();
+        }
+        try {
+            $result = $awaited->wait();
+        } catch (CouchbaseException $exception) {
+            return $fiber->throw($exception);
+        }
+        return $fiber->resume($result);
+    }
+}
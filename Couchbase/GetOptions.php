@@ -20,12 +20,16 @@ declare(strict_types=1);
 
 namespace Couchbase;
 
+use Couchbase\Exception\InvalidArgumentException;
+
 class GetOptions
 {
     private Transcoder $transcoder;
     private ?int $timeoutMilliseconds = null;
     private bool $withExpiry = false;
     private ?array $projections = null;
+    private bool $bypassReadCache = false;
+    private ?int $replicaFallbackMilliseconds = null;
 
     /**
      * @since 4.0.0
@@ -97,6 +101,48 @@ class GetOptions
         return $this;
     }
 
+    /**
+     * Sets whether to fetch the document from the server even if the read cache is enabled and holds the document.
+     * The response still refreshes the cache.
+     *
+     * @param bool $bypass
+     *
+     * @return GetOptions
+     * @see ClusterOptions::readCache()
+     * @since 4.2.5
+     */
+    public function bypassReadCache(bool $bypass): GetOptions
+    {
+        $this->bypassReadCache = $bypass;
+        return $this;
+    }
+
+    /**
+     * Reads the document from the fastest replica, if the active node does not respond within given time.
+     *
+     * The result of such read might be stale, use GetResult::isReplica() to check where the document came from.
+     * The option cannot be combined with withExpiry() or project().
+     *
+     * When timeout() is also set, it bounds the whole operation: the active node is given the smaller of the two
+     * values, and the replicas get the rest of the timeout. Without timeout(), the read from the replicas is
+     * given the full default key-value timeout of the cluster, so the operation might take up to the fallback
+     * delay plus that timeout.
+     *
+     * @param int $milliseconds how long to wait for the active node before falling back to the replicas
+     *
+     * @return GetOptions
+     * @throws InvalidArgumentException
+     * @since 4.2.5
+     */
+    public function replicaFallback(int $milliseconds): GetOptions
+    {
+        if ($milliseconds < 1) {
+            throw new InvalidArgumentException("Replica fallback delay must be positive");
+        }
+        $this->replicaFallbackMilliseconds = $milliseconds;
+        return $this;
+    }
+
     /**
      * Associate custom transcoder with the request.
      *
@@ -127,6 +173,84 @@ class GetOptions
         return $options->transcoder;
     }
 
+    /**
+     * Returns whether the response might be served from the read cache. Gets with projections or expiry
+     * fetch different responses and are never cached.
+     *
+     * @param GetOptions|null $options
+     *
+     * @return bool
+     * @internal
+     * @since 4.2.5
+     */
+    public static function isReadCacheable(?GetOptions $options): bool
+    {
+        if ($options == null) {
+            return true;
+        }
+        return !$options->withExpiry && $options->projections == null;
+    }
+
+    /**
+     * Returns whether the response must be fetched from the server, even if it is cached.
+     *
+     * @param GetOptions|null $options
+     *
+     * @return bool
+     * @internal
+     * @since 4.2.5
+     */
+    public static function bypassesReadCache(?GetOptions $options): bool
+    {
+        return $options != null && $options->bypassReadCache;
+    }
+
+    /**
+     * Returns options to use for the read from the active node and for the fallback read from the replicas,
+     * or null if the replica fallback has not been requested.
+     *
+     * @param GetOptions|null $options
+     *
+     * @return array|null tuple of exported options for the active node and GetAnyReplicaOptions
+     * @throws InvalidArgumentException
+     * @internal
+     * @since 4.2.5
+     */
+    public static function replicaFallbackOptions(?GetOptions $options): ?array
+    {
+        if ($options == null || $options->replicaFallbackMilliseconds == null) {
+            return null;
+        }
+        if (!self::isReadCacheable($options)) {
+            throw new InvalidArgumentException("Replica fallback cannot be combined with expiry or projections");
+        }
+        $exported = self::export($options);
+        $exported['timeoutMilliseconds'] = $options->replicaFallbackMilliseconds;
+        $replicaOptions = GetAnyReplicaOptions::build()->transcoder($options->transcoder);
+        if ($options->timeoutMilliseconds != null) {
+            $exported['timeoutMilliseconds'] = min($options->replicaFallbackMilliseconds, $options->timeoutMilliseconds);
+            $replicaOptions->timeout(max(1, $options->timeoutMilliseconds - $options->replicaFallbackMilliseconds));
+        }
+        return [$exported, $replicaOptions];
+    }
+
+    /**
+     * Exports options for the get which response is going to be stored in the read cache. Such gets always fetch
+     * the expiry of the document, so that the cache never serves the document after it expires.
+     *
+     * @param GetOptions|null $options
+     *
+     * @return array
+     * @internal
+     * @since 4.2.5
+     */
+    public static function exportForReadCache(?GetOptions $options): array
+    {
+        $exported = self::export($options);
+        $exported['withExpiry'] = true;
+        return $exported;
+    }
+
     /**
      * @internal
      *
@@ -32,6 +32,7 @@ class GetResult extends Result
     private ?int $expiry = null;
     private string $value;
     private int $flags;
+    private bool $isReplica = false;
 
     /**
      * @internal
@@ -50,6 +51,21 @@ class GetResult extends Result
         if (array_key_exists("expiry", $response)) {
             $this->expiry = $response["expiry"];
         }
+        if (array_key_exists("isReplica", $response)) {
+            $this->isReplica = $response["isReplica"];
+        }
+    }
+
+    /**
+     * Returns whether the document came from a replica server, which is only possible when
+     * GetOptions::replicaFallback() is used.
+     *
+     * @return bool
+     * @since 4.2.5
+     */
+    public function isReplica(): bool
+    {
+        return $this->isReplica;
     }
 
     /**
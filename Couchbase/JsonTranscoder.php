@@ -26,6 +26,7 @@ use JsonException;
 class JsonTranscoder implements Transcoder
 {
     private static ?JsonTranscoder $instance;
+    private static ?int $jsonFlags = null;
 
     public static function getInstance(): Transcoder
     {
@@ -73,9 +74,12 @@ class JsonTranscoder implements Transcoder
      */
     public function encode($value): array
     {
+        if (self::$jsonFlags === null) {
+            self::$jsonFlags = (new TranscoderFlags(TranscoderFlags::DATA_FORMAT_JSON))->encode();
+        }
         return [
             json_encode($value, $this->encodeFlags, $this->encodeDepth),
-            (new TranscoderFlags(TranscoderFlags::DATA_FORMAT_JSON))->encode(),
+            self::$jsonFlags,
         ];
     }
 
@@ -91,7 +95,7 @@ class JsonTranscoder implements Transcoder
      */
     public function decode(string $bytes, int $flags)
     {
-        if (TranscoderFlags::decode($flags)->isJson() || $flags == 0 /* subdoc API cannot set flags */) {
+        if ($flags == 0 /* subdoc API cannot set flags */ || TranscoderFlags::decode($flags)->isJson()) {
             try {
                 return json_decode($bytes, $this->decodeAssociative, $this->decodeDepth, $this->decodeFlags);
             } catch (JsonException $e) {
@@ -100,4 +104,43 @@ class JsonTranscoder implements Transcoder
         }
         throw new DecodingFailureException(sprintf("unable to decode bytes with JsonTranscoder: unknown flags 0x%08x", $flags));
     }
+
+    /**
+     * Decodes list of values, that share the same flags (e.g. rows of the query result), with single invocation
+     * of json_decode(), instead of calling decode() for each of them.
+     *
+     * @param array<string> $values list of encoded values
+     * @param int $flags flags from network layer, that describes format of the encoded data
+     *
+     * @return array list of decoded values in the same order
+     * @throws DecodingFailureException
+     * @since 4.2.5
+     */
+    public function decodeMany(array $values, int $flags): array
+    {
+        if (count($values) == 0) {
+            return [];
+        }
+        if ($flags == 0 || TranscoderFlags::decode($flags)->isJson()) {
+            try {
+                $decoded = json_decode(
+                    "[" . implode(",", $values) . "]",
+                    $this->decodeAssociative,
+                    $this->decodeDepth + 1,
+                    $this->decodeFlags
+                );
+            } catch (JsonException $e) {
+                $decoded = null;
+            }
+            if (is_array($decoded) && count($decoded) == count($values)) {
+                return $decoded;
+            }
+        }
+        // let decode() report the failure for the particular value
+        $result = [];
+        foreach ($values as $value) {
+            $result[] = $this->decode($value, $flags);
+        }
+        return $result;
+    }
 }
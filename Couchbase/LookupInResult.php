@@ -33,6 +33,7 @@ class LookupInResult extends Result
 {
     private Transcoder $transcoder;
     private array $fields;
+    private ?array $pathIndex = null;
 
     /**
      * @param array $response raw response from the extension
@@ -80,17 +81,15 @@ class LookupInResult extends Result
      */
     public function contentByPath(string $path)
     {
-        foreach ($this->fields as $field) {
-            if (array_key_exists('path', $field)) {
-                if ($field['path'] == $path) {
-                    if (!array_key_exists('exists', $field) || !$field['exists']) {
-                        throw new PathNotFoundException(sprintf("LookupIn path is not found for path: %s", $path));
-                    }
-                    return $this->transcoder->decode($field['value'], 0);
-                }
-            }
+        $index = $this->indexOfPath($path);
+        if ($index === null) {
+            throw new OutOfBoundsException(sprintf("LookupIn result does not have entry for path: %s", $path));
+        }
+        $field = $this->fields[$index];
+        if (!array_key_exists('exists', $field) || !$field['exists']) {
+            throw new PathNotFoundException(sprintf("LookupIn path is not found for path: %s", $path));
         }
-        throw new OutOfBoundsException(sprintf("LookupIn result does not have entry for path: %s", $path));
+        return $this->transcoder->decode($field['value'], 0);
     }
 
     /**
@@ -119,14 +118,11 @@ class LookupInResult extends Result
      */
     public function existsByPath(string $path): bool
     {
-        foreach ($this->fields as $field) {
-            if ($field['path'] == $path) {
-                if (array_key_exists('exists', $field)) {
-                    return $field['exists'];
-                }
-            }
+        $index = $this->indexOfPath($path);
+        if ($index === null) {
+            return false;
         }
-        return false;
+        return $this->exists($index);
     }
 
     /**
@@ -164,4 +160,25 @@ class LookupInResult extends Result
         }
         return null;
     }
+
+    /**
+     * Returns index of the first field with given path. The index is built on first access, so that lookups by path
+     * do not scan all fields every time.
+     *
+     * @param string $path
+     *
+     * @return int|null
+     */
+    private function indexOfPath(string $path): ?int
+    {
+        if ($this->pathIndex === null) {
+            $this->pathIndex = [];
+            foreach ($this->fields as $index => $field) {
+                if (array_key_exists('path', $field) && !array_key_exists($field['path'], $this->pathIndex)) {
+                    $this->pathIndex[$field['path']] = $index;
+                }
+            }
+        }
+        return $this->pathIndex[$path] ?? null;
+    }
 }
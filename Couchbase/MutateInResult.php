@@ -30,6 +30,7 @@ class MutateInResult extends MutationResult
 {
     private bool $deleted;
     private array $fields;
+    private ?array $pathIndex = null;
 
     /**
      * @param array $response raw response from the extension
@@ -81,11 +82,17 @@ class MutateInResult extends MutationResult
      */
     public function contentByPath(string $path)
     {
-        foreach ($this->fields as $field) {
-            if ($field['path'] == $path) {
-                return JsonTranscoder::getInstance()->decode($field['value'], 0);
+        if ($this->pathIndex === null) {
+            $this->pathIndex = [];
+            foreach ($this->fields as $index => $field) {
+                if (!array_key_exists($field['path'], $this->pathIndex)) {
+                    $this->pathIndex[$field['path']] = $index;
+                }
             }
         }
+        if (array_key_exists($path, $this->pathIndex)) {
+            return JsonTranscoder::getInstance()->decode($this->fields[$this->pathIndex[$path]]['value'], 0);
+        }
         throw new OutOfBoundsException(sprintf("MutateIn result does not have entry for path: %s", $path));
     }
 
@@ -0,0 +1,141 @@
+<?php
+
+/**
+ * Copyright 2014-Present Couchbase, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+declare(strict_types=1);
+
+namespace Couchbase;
+
+use Couchbase\Exception\CouchbaseException;
+
+/**
+ * Accumulates operations of the same kind, issued against the same collection with the same options, so that
+ * they can be sent to the server in a single multi-operation call of the extension.
+ *
+ * @internal
+ *
+ * @since 4.2.5
+ */
+class PendingOperationBatch
+{
+    /**
+     * @var callable
+     */
+    private $dispatcher;
+    private array $entries = [];
+    private array $indexByKey = [];
+    private ?array $results = null;
+    private ?CouchbaseException $error = null;
+
+    /**
+     * @param callable $dispatcher receives the array of queued entries and returns the array of results, one for
+     *     each of the entries, in the same order
+     *
+     * @internal
+     *
+     * @since 4.2.5
+     */
+    public function __construct(callable $dispatcher)
+    {
+        $this->dispatcher = $dispatcher;
+    }
+
+    /**
+     * @param mixed $entry the entry to pass to the dispatcher
+     * @param string $documentId the key of the document the operation is performed on
+     * @param bool $deduplicate if true, operations on the same document share single entry of the batch, and
+     *     receive the same result (only safe for reads)
+     *
+     * @return PendingResult
+     * @internal
+     *
+     * @since 4.2.5
+     */
+    public function enqueue($entry, string $documentId, bool $deduplicate = false): PendingResult
+    {
+        if ($deduplicate && array_key_exists($documentId, $this->indexByKey)) {
+            return new PendingResult($this, $this->indexByKey[$documentId]);
+        }
+        $this->entries[] = $entry;
+        $index = count($this->entries) - 1;
+        $this->indexByKey[$documentId] = $index;
+        return new PendingResult($this, $index);
+    }
+
+    /**
+     * @param string $documentId the key of the document
+     *
+     * @return bool true if the batch already has an operation on the document
+     * @internal
+     *
+     * @since 4.2.5
+     */
+    public function contains(string $documentId): bool
+    {
+        return array_key_exists($documentId, $this->indexByKey);
+    }
+
+    /**
+     * @return bool true if the batch has already been sent to the server
+     * @internal
+     *
+     * @since 4.2.5
+     */
+    public function isDispatched(): bool
+    {
+        return $this->results !== null || $this->error !== null;
+    }
+
+    /**
+     * Sends all queued operations in one call. Subsequent invocations do nothing.
+     *
+     * @internal
+     *
+     * @since 4.2.5
+     */
+    public function dispatch(): void
+    {
+        if ($this->isDispatched() || count($this->entries) == 0) {
+            return;
+        }
+        try {
+            $this->results = array_values(($this->dispatcher)($this->entries));
+        } catch (CouchbaseException $exception) {
+            $this->error = $exception;
+        }
+        $this->entries = [];
+        $this->indexByKey = [];
+    }
+
+    /**
+     * @param int $index position of the entry in the batch
+     *
+     * @return Result
+     * @throws CouchbaseException if the whole batch has failed
+     * @internal
+     *
+     * @since 4.2.5
+     */
+    public function result(int $index): Result
+    {
+        $this->dispatch();
+        if ($this->error != null) {
+            throw $this->error;
+        }
+        return $this->results[$index];
+    }
+}
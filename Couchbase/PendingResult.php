@@ -0,0 +1,113 @@
+<?php
+
+/**
+ * Copyright 2014-Present Couchbase, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+declare(strict_types=1);
+
+namespace Couchbase;
+
+use Couchbase\Exception\CouchbaseException;
+
+/**
+ * PendingResult is a handle for the operation started with one of the asynchronous methods of the Collection
+ * (e.g. getAsync(), upsertAsync()).
+ *
+ * Consecutive operations of the same kind and with the same options are grouped together, and the whole group is
+ * sent to the server in a single call as soon as the result of any of its members is requested, or before the next
+ * operation of the collection that does not belong to the group. This way a fan-out of independent operations costs
+ * about one round trip instead of one per document, while the operations still reach the server in order.
+ *
+ * @see Collection::getAsync()
+ * @see Collection::upsertAsync()
+ * @see Collection::removeAsync()
+ * @see Cluster::waitAll()
+ * @see Cluster::waitAny()
+ *
+ * @since 4.2.5
+ */
+class PendingResult
+{
+    private PendingOperationBatch $batch;
+    private int $index;
+
+    /**
+     * @param PendingOperationBatch $batch
+     * @param int $index
+     *
+     * @internal
+     *
+     * @since 4.2.5
+     */
+    public function __construct(PendingOperationBatch $batch, int $index)
+    {
+        $this->batch = $batch;
+        $this->index = $index;
+    }
+
+    /**
+     * Returns true if the operation has been sent to the server and its result is available without blocking.
+     *
+     * @return bool
+     * @since 4.2.5
+     */
+    public function isReady(): bool
+    {
+        return $this->batch->isDispatched();
+    }
+
+    /**
+     * Blocks until the operation completes and returns the result. Like the synchronous counterpart of the
+     * operation, it throws an exception if the operation has failed.
+     *
+     * @return Result the same type of the result as returned by the synchronous operation
+     * @throws CouchbaseException
+     * @since 4.2.5
+     */
+    public function wait(): Result
+    {
+        $result = $this->result();
+        if ($result->error() != null) {
+            throw $result->error();
+        }
+        return $result;
+    }
+
+    /**
+     * Blocks until the operation completes and returns the result. Unlike wait(), it does not throw if the
+     * operation has failed, but fills error() property of the result object, like multi-operations do.
+     *
+     * @return Result
+     * @throws CouchbaseException if the whole group of operations has been rejected
+     * @internal
+     *
+     * @since 4.2.5
+     */
+    public function result(): Result
+    {
+        return $this->batch->result($this->index);
+    }
+
+    /**
+     * @internal
+     *
+     * @since 4.2.5
+     */
+    public function dispatch(): void
+    {
+        $this->batch->dispatch();
+    }
+}
@@ -20,6 +20,8 @@ declare(strict_types=1);
 
 namespace Couchbase;
 
+use Couchbase\Exception\InvalidArgumentException;
+
 /**
  * A PrefixScan selects every document whose ID starts with a certain prefix
  */
@@ -62,6 +64,47 @@ class PrefixScan implements ScanType
         return $this;
     }
 
+    /**
+     * Returns the equivalent range scan.
+     *
+     * @return RangeScan
+     * @since 4.2.5
+     */
+    public function toRangeScan(): RangeScan
+    {
+        return new RangeScan(new ScanTerm($this->prefix), new ScanTerm($this->prefix . "\xff"));
+    }
+
+    /**
+     * Splits the set of keys with the prefix into disjoint ranges, so that they can be scanned concurrently
+     * by independent workers.
+     *
+     * @param int $count the desired number of ranges
+     *
+     * @return array<RangeScan>
+     * @throws InvalidArgumentException
+     * @see RangeScan::partition()
+     * @since 4.2.5
+     */
+    public function partition(int $count): array
+    {
+        return $this->toRangeScan()->partition($count, $this->prefix);
+    }
+
+    /**
+     * Returns the range, that continues the scan after the given key.
+     *
+     * @param string $id the last processed key
+     *
+     * @return RangeScan
+     * @see RangeScan::resumeAfter()
+     * @since 4.2.5
+     */
+    public function resumeAfter(string $id): RangeScan
+    {
+        return $this->toRangeScan()->resumeAfter($id);
+    }
+
     /**
      * @internal
      *
@@ -0,0 +1,75 @@
+<?php
+
+/**
+ * Copyright 2014-Present Couchbase, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+declare(strict_types=1);
+
+namespace Couchbase;
+
+use Couchbase\Exception\InvalidArgumentException;
+
+/**
+ * List of subdocument lookup specs exported once, and reused by Collection::lookupIn() without allocating and
+ * exporting the spec objects on every call.
+ *
+ * <code>
+ * $specs = PreparedLookupInSpecs::build([LookupGetSpec::build("name"), LookupCountSpec::build("tags")]);
+ * foreach ($ids as $id) {
+ *     $result = $collection->lookupIn($id, $specs);
+ * }
+ * </code>
+ *
+ * @since 4.2.5
+ */
+class PreparedLookupInSpecs
+{
+    private array $encoded;
+
+    private function __construct(array $encoded)
+    {
+        $this->encoded = $encoded;
+    }
+
+    /**
+     * @param array<LookupInSpec> $specs
+     *
+     * @return PreparedLookupInSpecs
+     * @throws InvalidArgumentException
+     * @since 4.2.5
+     */
+    public static function build(array $specs): PreparedLookupInSpecs
+    {
+        $encoded = [];
+        foreach ($specs as $spec) {
+            if (!($spec instanceof LookupInSpec)) {
+                throw new InvalidArgumentException("Expected every spec to implement LookupInSpec");
+            }
+            $encoded[] = $spec->export();
+        }
+        return new PreparedLookupInSpecs($encoded);
+    }
+
+    /**
+     * @internal
+     * @return array
+     * @since 4.2.5
+     */
+    public function export(): array
+    {
+        return $this->encoded;
+    }
+}
@@ -0,0 +1,140 @@
+<?php
+
+/**
+ * Copyright 2014-Present Couchbase, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+declare(strict_types=1);
+
+namespace Couchbase;
+
+use Couchbase\Exception\InvalidArgumentException;
+
+/**
+ * List of subdocument mutation specs exported once, and reused by Collection::mutateIn(). The values of the
+ * specs work as defaults, and can be replaced for a particular call with withValues(), so that only the changed
+ * values are encoded.
+ *
+ * <code>
+ * $specs = PreparedMutateInSpecs::build([
+ *     MutateCounterSpec::build("visits", 1),
+ *     MutateUpsertSpec::build("lastVisitor", null),
+ * ]);
+ * foreach ($visits as $id => $visitor) {
+ *     $collection->mutateIn($id, $specs->withValues([1 => $visitor]));
+ * }
+ * </code>
+ *
+ * @since 4.2.5
+ */
+class PreparedMutateInSpecs
+{
+    private array $encoded;
+    private array $values = [];
+
+    private function __construct(array $encoded)
+    {
+        $this->encoded = $encoded;
+    }
+
+    /**
+     * @param array<MutateInSpec> $specs
+     * @param MutateInOptions|null $options the options, which transcoder is used to encode the values of the specs
+     *
+     * @return PreparedMutateInSpecs
+     * @throws InvalidArgumentException
+     * @since 4.2.5
+     */
+    public static function build(array $specs, ?MutateInOptions $options = null): PreparedMutateInSpecs
+    {
+        $encoded = [];
+        foreach ($specs as $spec) {
+            if (!($spec instanceof MutateInSpec)) {
+                throw new InvalidArgumentException("Expected every spec to implement MutateInSpec");
+            }
+            $encoded[] = $spec->export($options);
+        }
+        return new PreparedMutateInSpecs($encoded);
+    }
+
+    /**
+     * Returns copy of the prepared specs with the values replaced for the given positions. The values are encoded
+     * with the transcoder of the options passed to Collection::mutateIn(). Array operations expect array of values,
+     * and counters expect integer delta.
+     *
+     * @param array $values new values keyed by position of the spec
+     *
+     * @return PreparedMutateInSpecs
+     * @throws InvalidArgumentException
+     * @since 4.2.5
+     */
+    public function withValues(array $values): PreparedMutateInSpecs
+    {
+        foreach ($values as $index => $value) {
+            if (!array_key_exists($index, $this->encoded) || !array_key_exists('value', $this->encoded[$index])) {
+                throw new InvalidArgumentException(sprintf("Spec at position %s does not take a value", $index));
+            }
+            if ($this->encoded[$index]['opcode'] == 'counter' && !is_int($value)) {
+                throw new InvalidArgumentException(sprintf("Counter spec at position %s expects integer delta", $index));
+            }
+            if (self::takesList($this->encoded[$index]['opcode']) && !is_array($value)) {
+                throw new InvalidArgumentException(sprintf("Array spec at position %s expects array of values", $index));
+            }
+        }
+        $prepared = clone $this;
+        $prepared->values = $values;
+        return $prepared;
+    }
+
+    /**
+     * @internal
+     *
+     * @param MutateInOptions|null $options
+     *
+     * @return array
+     * @since 4.2.5
+     */
+    public function export(?MutateInOptions $options): array
+    {
+        if (count($this->values) == 0) {
+            return $this->encoded;
+        }
+        $encoded = $this->encoded;
+        foreach ($this->values as $index => $value) {
+            $opcode = $encoded[$index]['opcode'];
+            if ($opcode == 'counter') {
+                $encoded[$index]['value'] = $value;
+            } elseif (self::takesList($opcode)) {
+                $encoded[$index]['value'] = join(
+                    ",",
+                    array_map(
+                        function ($item) use ($options) {
+                            return MutateInOptions::encodeValue($options, $item);
+                        },
+                        $value
+                    )
+                );
+            } else {
+                $encoded[$index]['value'] = MutateInOptions::encodeValue($options, $value);
+            }
+        }
+        return $encoded;
+    }
+
+    private static function takesList(string $opcode): bool
+    {
+        return $opcode == 'arrayPushLast' || $opcode == 'arrayPushFirst' || $opcode == 'arrayInsert';
+    }
+}
@@ -0,0 +1,192 @@
+<?php
+
+/**
+ * Copyright 2014-Present Couchbase, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+declare(strict_types=1);
+
+namespace Couchbase;
+
+use Couchbase\Exception\CouchbaseException;
+use Couchbase\Exception\PreparedStatementFailureException;
+
+/**
+ * Tracks named prepared statements, shared by all Cluster objects of the process that use the same connection.
+ *
+ * The name of the prepared statement is derived from the statement text and the query context, so that every
+ * process computes the same name. The query service keeps named prepared statements on its side, therefore a
+ * freshly started worker can execute a statement prepared by another process without preparing it again.
+ *
+ * @internal
+ *
+ * @since 4.2.5
+ */
+class PreparedStatementCache
+{
+    /**
+     * Upper bound for the number of statements tracked by the process.
+     */
+    private const MAX_ENTRIES = 4096;
+
+    /**
+     * @var array<string, PreparedStatementCache>
+     */
+    private static array $instances = [];
+
+    /**
+     * @var array<string, bool> names of the statements known to be prepared on the query service
+     */
+    private array $prepared = [];
+    private int $hits = 0;
+    private int $misses = 0;
+    private int $invalidations = 0;
+
+    /**
+     * @param string $connectionHash
+     *
+     * @return PreparedStatementCache
+     * @internal
+     *
+     * @since 4.2.5
+     */
+    public static function forConnection(string $connectionHash): PreparedStatementCache
+    {
+        if (!array_key_exists($connectionHash, self::$instances)) {
+            self::$instances[$connectionHash] = new PreparedStatementCache();
+        }
+        return self::$instances[$connectionHash];
+    }
+
+    /**
+     * @param string $statement
+     * @param string|null $queryContext
+     *
+     * @return string
+     * @internal
+     *
+     * @since 4.2.5
+     */
+    public static function name(string $statement, ?string $queryContext): string
+    {
+        return "php-" . hash("sha256", sprintf("--%s--%s--", $queryContext, $statement));
+    }
+
+    /**
+     * @param string $statement
+     * @param string|null $queryContext
+     *
+     * @return bool true if the statement has been prepared through this cache
+     * @internal
+     *
+     * @since 4.2.5
+     */
+    public function contains(string $statement, ?string $queryContext): bool
+    {
+        return array_key_exists(self::name($statement, $queryContext), $this->prepared);
+    }
+
+    /**
+     * Prepares the statement on the query service under the derived name.
+     *
+     * @param resource $core
+     * @param string $statement
+     * @param array $exportedOptions options of the query, as produced by QueryOptions::export()
+     *
+     * @return string name of the prepared statement
+     * @throws CouchbaseException
+     * @internal
+     *
+     * @since 4.2.5
+     */
+    public function prepare($core, string $statement, array $exportedOptions): string
+    {
+        $queryContext = $exportedOptions['queryContext'] ?? null;
+        $name = self::name($statement, $queryContext);
+        Extension\query(
+            $core,
+            sprintf("PREPARE `%s` FROM %s", $name, $statement),
+            [
+                'timeoutMilliseconds' => $exportedOptions['timeoutMilliseconds'] ?? null,
+                'clientContextId' => $exportedOptions['clientContextId'] ?? null,
+                'queryContext' => $queryContext,
+                'adHoc' => true,
+            ]
+        );
+        $this->remember($name);
+        return $name;
+    }
+
+    /**
+     * Executes the statement by its name, preparing it if the query service does not know it (or reports that
+     * the plan is stale).
+     *
+     * @param resource $core
+     * @param string $statement
+     * @param array $exportedOptions options of the query, as produced by QueryOptions::export()
+     *
+     * @return array raw query response
+     * @throws CouchbaseException
+     * @internal
+     *
+     * @since 4.2.5
+     */
+    public function execute($core, string $statement, array $exportedOptions): array
+    {
+        $name = self::name($statement, $exportedOptions['queryContext'] ?? null);
+        // the statement is already prepared, the core must not prepare the EXECUTE statement once again
+        $exportedOptions['adHoc'] = true;
+        $known = array_key_exists($name, $this->prepared);
+        try {
+            $response = Extension\query($core, sprintf("EXECUTE `%s`", $name), $exportedOptions);
+            ++$this->hits;
+            $this->remember($name);
+            return $response;
+        } catch (PreparedStatementFailureException $exception) {
+            if ($known) {
+                ++$this->invalidations;
+                unset($this->prepared[$name]);
+            }
+        }
+        ++$this->misses;
+        $this->prepare($core, $statement, $exportedOptions);
+        return Extension\query($core, sprintf("EXECUTE `%s`", $name), $exportedOptions);
+    }
+
+    /**
+     * @return array
+     * @internal
+     *
+     * @since 4.2.5
+     */
+    public function stats(): array
+    {
+        return [
+            'entries' => count($this->prepared),
+            'hits' => $this->hits,
+            'misses' => $this->misses,
+            'invalidations' => $this->invalidations,
+        ];
+    }
+
+    private function remember(string $name): void
+    {
+        unset($this->prepared[$name]);
+        $this->prepared[$name] = true;
+        while (count($this->prepared) > self::MAX_ENTRIES) {
+            unset($this->prepared[array_key_first($this->prepared)]);
+        }
+    }
+}
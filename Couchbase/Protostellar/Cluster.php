@@ -36,6 +36,9 @@ use Couchbase\Protostellar\Internal\TimeoutHandler;
 use Couchbase\Protostellar\Management\BucketManager;
 use Couchbase\Protostellar\Management\QueryIndexManager;
 use Couchbase\Protostellar\Management\SearchIndexManager;
+use Couchbase\Protostellar\Retries\BestEffortRetryStrategy;
+use Couchbase\Protostellar\Retries\RetryBudget;
+use Couchbase\Protostellar\Retries\RetryOrchestrator;
 use Couchbase\QueryOptions;
 use Couchbase\QueryResult;
 use Couchbase\SearchOptions;
@@ -50,6 +53,23 @@ class Cluster implements ClusterInterface
     public function __construct(string $connectionString, ClusterOptions $options = new ClusterOptions())
     {
         $this->client = new Client($connectionString, $options);
+        if (!is_null($options->getRetryBudget())) {
+            RetryBudget::configure(...$options->getRetryBudget());
+        }
+        if (!is_null($options->getMaxRetryAttempts()) || $options->getRetryBackoffJitter()) {
+            BestEffortRetryStrategy::configure($options->getMaxRetryAttempts(), $options->getRetryBackoffJitter());
+        }
+    }
+
+    /**
+     * Returns number of retries performed by the process, keyed by retry reason.
+     *
+     * @return array<string, int>
+     * @since 4.2.5
+     */
+    public function retryCounters(): array
+    {
+        return RetryOrchestrator::retryCounters();
     }
 
     public function close()
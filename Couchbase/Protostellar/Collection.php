@@ -22,6 +22,7 @@ namespace Couchbase\Protostellar;
 
 use Couchbase\BinaryCollectionInterface;
 use Couchbase\CollectionInterface;
+use Couchbase\Exception\CouchbaseException;
 use Couchbase\Exception\DecodingFailureException;
 use Couchbase\Exception\DocumentIrretrievableException;
 use Couchbase\Exception\DocumentNotFoundException;
@@ -54,6 +55,7 @@ use Couchbase\Result;
 use Couchbase\TouchOptions;
 use Couchbase\UnlockOptions;
 use Couchbase\UpsertOptions;
+use Exception;
 
 class Collection implements CollectionInterface
 {
@@ -164,6 +166,114 @@ class Collection implements CollectionInterface
         return KVResponseConverter::convertGetResult($key, $res, $options);
     }
 
+    /**
+     * Fetches a group of documents, issuing all calls concurrently.
+     *
+     * @param array<string> $keys
+     * @param GetOptions|null $options
+     *
+     * @return array<GetResult|Result> results in the order of the keys, failed operations have error() set
+     * @throws InvalidArgumentException
+     * @since 4.2.5
+     */
+    public function getMulti(array $keys, ?GetOptions $options = null): array
+    {
+        $exportedOptions = GetOptions::export($options);
+        $timeout = $this->client->timeoutHandler()->getTimeout(TimeoutHandler::KV, $exportedOptions);
+        $requests = [];
+        foreach ($keys as $index => $key) {
+            $request = RequestFactory::makeRequest(
+                ['Couchbase\Protostellar\Internal\KV\KVRequestConverter', 'getGetRequest'],
+                [$key, $exportedOptions, KVRequestConverter::getLocation($this->bucketName, $this->scopeName, $this->name)]
+            );
+            $requests[$index] = SharedUtils::createProtostellarRequest($request, true, $timeout);
+        }
+        $responses = ProtostellarOperationRunner::runUnaryMulti($requests, [$this->client->kv(), 'Get']);
+        $results = [];
+        foreach ($responses as $index => $response) {
+            $results[$index] = $response instanceof Exception
+                ? self::failedResult($keys[$index], $response)
+                : KVResponseConverter::convertGetResult($keys[$index], $response, $options);
+        }
+        return $results;
+    }
+
+    /**
+     * Creates or updates a group of documents, issuing all calls concurrently.
+     *
+     * @param array $entries array of arrays, organized like this [["key1", $value1], ["key2", $value2], ...]
+     * @param UpsertOptions|null $options
+     *
+     * @return array<MutationResult|Result> results in the order of the entries, failed operations have error() set
+     * @throws InvalidArgumentException
+     * @since 4.2.5
+     */
+    public function upsertMulti(array $entries, ?UpsertOptions $options = null): array
+    {
+        $exportedOptions = UpsertOptions::export($options);
+        $timeout = $this->client->timeoutHandler()->getTimeout(TimeoutHandler::KV, $exportedOptions);
+        $requests = [];
+        foreach ($entries as $index => $entry) {
+            $request = RequestFactory::makeRequest(
+                ['Couchbase\Protostellar\Internal\KV\KVRequestConverter', 'getUpsertRequest'],
+                [$entry[0], $entry[1], KVRequestConverter::getLocation($this->bucketName, $this->scopeName, $this->name), $options]
+            );
+            $requests[$index] = SharedUtils::createProtostellarRequest($request, false, $timeout);
+        }
+        $responses = ProtostellarOperationRunner::runUnaryMulti($requests, [$this->client->kv(), 'Upsert']);
+        $results = [];
+        foreach ($responses as $index => $response) {
+            $results[$index] = $response instanceof Exception
+                ? self::failedResult($entries[$index][0], $response)
+                : KVResponseConverter::convertMutationResult($entries[$index][0], $response);
+        }
+        return $results;
+    }
+
+    /**
+     * Removes a group of documents, issuing all calls concurrently. If second element of the entry (CAS) is null,
+     * then the operation will remove the document unconditionally.
+     *
+     * @param array $entries array of arrays, organized like this
+     *   [["key1", "encodedCas1"], ["key2", "encodedCas2"], ...] or ["key1", "key2", ...]
+     * @param RemoveOptions|null $options
+     *
+     * @return array<MutationResult|Result> results in the order of the entries, failed operations have error() set
+     * @throws InvalidArgumentException
+     * @since 4.2.5
+     */
+    public function removeMulti(array $entries, ?RemoveOptions $options = null): array
+    {
+        $exportedOptions = RemoveOptions::export($options);
+        $timeout = $this->client->timeoutHandler()->getTimeout(TimeoutHandler::KV, $exportedOptions);
+        $keys = [];
+        $requests = [];
+        foreach ($entries as $index => $entry) {
+            $entryOptions = $exportedOptions;
+            if (is_array($entry)) {
+                $keys[$index] = $entry[0];
+                if (isset($entry[1])) {
+                    $entryOptions["cas"] = $entry[1];
+                }
+            } else {
+                $keys[$index] = $entry;
+            }
+            $request = RequestFactory::makeRequest(
+                ['Couchbase\Protostellar\Internal\KV\KVRequestConverter', 'getRemoveRequest'],
+                [$keys[$index], $entryOptions, KVRequestConverter::getLocation($this->bucketName, $this->scopeName, $this->name)]
+            );
+            $requests[$index] = SharedUtils::createProtostellarRequest($request, false, $timeout);
+        }
+        $responses = ProtostellarOperationRunner::runUnaryMulti($requests, [$this->client->kv(), 'Remove']);
+        $results = [];
+        foreach ($responses as $index => $response) {
+            $results[$index] = $response instanceof Exception
+                ? self::failedResult($keys[$index], $response)
+                : KVResponseConverter::convertMutationResult($keys[$index], $response);
+        }
+        return $results;
+    }
+
     public function exists(string $key, ?ExistsOptions $options = null): ExistsResult
     {
         $exportedOptions = ExistsOptions::export($options);
@@ -294,7 +404,7 @@ class Collection implements CollectionInterface
             [$key, KVRequestConverter::getLocation($this->bucketName, $this->scopeName, $this->name)]
         );
         $timeout = $this->client->timeoutHandler()->getTimeout(TimeoutHandler::KV, $exportedOptions);
-        $response = ProtostellarOperationRunner::runStreaming(
+        $response = ProtostellarOperationRunner::runStreamingFirst(
             SharedUtils::createProtostellarRequest($request, true, $timeout),
             [$this->client->kv(), 'GetAllReplicas']
         );
@@ -319,6 +429,17 @@ class Collection implements CollectionInterface
         return KVResponseConverter::convertGetAllReplicasResult($key, $response, $options);
     }
 
+    /**
+     * @throws Exception if the error is not a CouchbaseException, and cannot be reported through Result::error()
+     */
+    private static function failedResult(string $key, Exception $exception): Result
+    {
+        if (!($exception instanceof CouchbaseException)) {
+            throw $exception;
+        }
+        return new Result(["id" => $key, "error" => $exception]);
+    }
+
     public function bucketName(): string
     {
         return $this->bucketName;
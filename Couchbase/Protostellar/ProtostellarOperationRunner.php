@@ -51,6 +51,84 @@ class ProtostellarOperationRunner
             return $response;
         }
     }
+    /**
+     * Issues all unary calls at once over the shared channel, and then waits for their completion. Failed calls,
+     * that are allowed to be retried, are reissued together after single backoff interval.
+     *
+     * @param array<ProtostellarRequest> $requests
+     * @param callable $grpcCall
+     *
+     * @return array responses or exceptions, with the same keys as the array of requests
+     * @throws Exception
+     */
+    public static function runUnaryMulti(array $requests, callable $grpcCall): array
+    {
+        $results = array_fill_keys(array_keys($requests), null);
+        while (count($requests) > 0) {
+            $pendingCalls = [];
+            foreach ($requests as $index => $request) {
+                $pendingCalls[$index] = $grpcCall(
+                    $request->grpcRequest(),
+                    [],
+                    ['timeout' => self::calculateGRPCTimeout($request->absoluteTimeout())]
+                );
+            }
+            $retries = [];
+            $retryDuration = 0;
+            foreach ($pendingCalls as $index => $pendingCall) {
+                [$response, $status] = $pendingCall->wait();
+                if ($status->code === STATUS_OK) {
+                    $results[$index] = $response;
+                    continue;
+                }
+                $behaviour = ExceptionConverter::convertError($status, $requests[$index]);
+                if (is_null($behaviour->retryDuration())) {
+                    $results[$index] = $behaviour->exception();
+                    continue;
+                }
+                $retries[$index] = $requests[$index];
+                $retryDuration = max($retryDuration, $behaviour->retryDuration());
+            }
+            if (count($retries) > 0) {
+                usleep($retryDuration);
+            }
+            $requests = $retries;
+        }
+        return $results;
+    }
+
+    /**
+     * Reads the response stream only until the first message, and cancels the rest of the call.
+     *
+     * @return array empty array, or array with the first response of the stream
+     * @throws Exception
+     */
+    public static function runStreamingFirst(ProtostellarRequest $request, callable $grpcFunc): array
+    {
+        while (true) {
+            $pendingCall = $grpcFunc(
+                $request->grpcRequest(),
+                [],
+                ['timeout' => self::calculateGRPCTimeout($request->absoluteTimeout())]
+            );
+            foreach ($pendingCall->responses() as $response) {
+                $pendingCall->cancel();
+                return [$response];
+            }
+            $status = $pendingCall->getStatus();
+            if ($status->code !== STATUS_OK) {
+                $behaviour = ExceptionConverter::convertError($status, $request);
+                if (!is_null($behaviour->retryDuration())) {
+                    usleep($behaviour->retryDuration());
+                    continue;
+                } else {
+                    throw $behaviour->exception();
+                }
+            }
+            return [];
+        }
+    }
+
     /**
      * @throws Exception
      */
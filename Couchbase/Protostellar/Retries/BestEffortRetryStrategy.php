@@ -24,24 +24,51 @@ use Couchbase\Protostellar\ProtostellarRequest;
 
 class BestEffortRetryStrategy implements RetryStrategy
 {
+    private static ?int $defaultMaxRetryAttempts = null;
+    private static bool $defaultJitter = false;
+
     private BackoffCalculator $calculator;
+    private ?int $maxRetryAttempts;
 
-    public function __construct(?BackoffCalculator $calculator = null)
+    /**
+     * @param BackoffCalculator|null $calculator
+     * @param int|null $maxRetryAttempts retry budget of the single request, or null to retry until the timeout
+     */
+    public function __construct(?BackoffCalculator $calculator = null, ?int $maxRetryAttempts = null)
     {
         if (is_null($calculator)) {
             $this->calculator = new ExponentialBackoff();
         } else {
             $this->calculator = $calculator;
         }
+        $this->maxRetryAttempts = $maxRetryAttempts;
+    }
+
+    /**
+     * Sets the defaults for the strategies created with build(), which is used for every request of the process.
+     *
+     * @param int|null $maxRetryAttempts retry budget of the single request, or null to retry until the timeout
+     * @param bool $jitter whether to randomize the backoff
+     */
+    public static function configure(?int $maxRetryAttempts, bool $jitter): void
+    {
+        self::$defaultMaxRetryAttempts = $maxRetryAttempts;
+        self::$defaultJitter = $jitter;
     }
 
     public static function build(): BestEffortRetryStrategy
     {
-        return new BestEffortRetryStrategy();
+        return new BestEffortRetryStrategy(
+            new ExponentialBackoff(1, 500, self::$defaultJitter),
+            self::$defaultMaxRetryAttempts
+        );
     }
 
     public function retryAfter(ProtostellarRequest $request, RetryReason $reason): RetryAction
     {
+        if (!is_null($this->maxRetryAttempts) && $request->retryAttempts() >= $this->maxRetryAttempts) {
+            return RetryAction::build(null);
+        }
         if ($request->idempotent() || $reason->allowsNonIdempotentRetry()) {
             $backoffDuration = $this->calculator->calculateBackoff($request);
             return RetryAction::build($backoffDuration);
@@ -21,31 +21,39 @@ declare(strict_types=1);
 namespace Couchbase\Protostellar\Retries;
 
 use Couchbase\Protostellar\ProtostellarRequest;
+use Couchbase\Utilities\Backoff;
 
 class ExponentialBackoff implements BackoffCalculator
 {
     private int $delayMicros;
     private int $maxDelayMicros;
-    public function __construct(int $delayMicros = 1, int $maxDelayMicros = 500)
+    private bool $jitter;
+
+    /**
+     * @param int $delayMicros
+     * @param int $maxDelayMicros
+     * @param bool $jitter whether to randomize the delay within its upper half, so that requests failed at the
+     *     same time are not retried at the same time
+     */
+    public function __construct(int $delayMicros = 1, int $maxDelayMicros = 500, bool $jitter = false)
     {
         $this->delayMicros = $delayMicros * 1000;
         $this->maxDelayMicros = $maxDelayMicros * 1000;
+        $this->jitter = $jitter;
     }
 
     /** With default values, backoff, as retry attempts increase:
-     * 1.5ms, 3.5ms, 7.5ms, 15.5ms, 31.5ms, 63.5ms, 127.5ms, 255.5ms, 500ms
+     * 1ms, 2ms, 4ms, 8ms, 16ms, 32ms, 64ms, 128ms, 256ms, 500ms
      * @param ProtostellarRequest $request
-     * @return float Backoff in microseconds
+     * @return int Backoff in microseconds
      */
     public function calculateBackoff(ProtostellarRequest $request): int
     {
-        $multiplier = pow(2, min(($request->retryAttempts() + 2), 30));
-        $delay = ($this->delayMicros * ($multiplier - 1) / 2);
-        return min($delay, $this->maxDelayMicros);
+        return Backoff::delay($this->delayMicros, $this->maxDelayMicros, $request->retryAttempts(), $this->jitter);
     }
 
-    public static function build(int $delayMicros, int $maxDelayMicros): ExponentialBackoff
+    public static function build(int $delayMicros, int $maxDelayMicros, bool $jitter = false): ExponentialBackoff
     {
-        return new ExponentialBackoff($delayMicros, $maxDelayMicros);
+        return new ExponentialBackoff($delayMicros, $maxDelayMicros, $jitter);
     }
 }
@@ -0,0 +1,90 @@
+<?php
+
+/*
+ * Copyright 2022-Present Couchbase, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+declare(strict_types=1);
+
+namespace Couchbase\Protostellar\Retries;
+
+/**
+ * Token bucket shared by all requests of the process, that limits the rate of retries. When the cluster is
+ * unavailable (e.g. during rebalance), requests fail instead of retrying once the bucket is empty, so that the
+ * cluster is not flooded with retries from all workers.
+ *
+ * The budget is unlimited until it is configured.
+ */
+class RetryBudget
+{
+    private static ?RetryBudget $instance = null;
+
+    private int $capacity;
+    private float $refillPerSecond;
+    private float $tokens;
+    private float $updatedAt;
+
+    private function __construct(int $capacity, float $refillPerSecond)
+    {
+        $this->capacity = $capacity;
+        $this->refillPerSecond = $refillPerSecond;
+        $this->tokens = $capacity;
+        $this->updatedAt = microtime(true);
+    }
+
+    /**
+     * Configures the budget. If the settings have not changed, the budget keeps its current state, so that
+     * creating another cluster object does not refill the bucket.
+     *
+     * @param int $capacity maximum number of retries allowed in a burst
+     * @param float $refillPerSecond number of retries added back to the budget every second
+     */
+    public static function configure(int $capacity, float $refillPerSecond): void
+    {
+        $capacity = max(1, $capacity);
+        $refillPerSecond = max(0.0, $refillPerSecond);
+        if (
+            !is_null(self::$instance) &&
+            self::$instance->capacity == $capacity &&
+            self::$instance->refillPerSecond == $refillPerSecond
+        ) {
+            return;
+        }
+        self::$instance = new RetryBudget($capacity, $refillPerSecond);
+    }
+
+    /**
+     * @return bool true if the retry is allowed, false if the budget has been exhausted
+     */
+    public static function tryAcquire(): bool
+    {
+        if (is_null(self::$instance)) {
+            return true;
+        }
+        return self::$instance->take();
+    }
+
+    private function take(): bool
+    {
+        $now = microtime(true);
+        $this->tokens = min($this->capacity, $this->tokens + ($now - $this->updatedAt) * $this->refillPerSecond);
+        $this->updatedAt = $now;
+        if ($this->tokens < 1) {
+            return false;
+        }
+        $this->tokens -= 1;
+        return true;
+    }
+}
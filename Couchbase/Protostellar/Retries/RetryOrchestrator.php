@@ -28,6 +28,11 @@ use Couchbase\Protostellar\RequestBehaviour;
 
 class RetryOrchestrator
 {
+    /**
+     * @var array<string, int> number of retries performed by the process, keyed by retry reason
+     */
+    private static array $retryCounters = [];
+
     public static function maybeRetry(ProtostellarRequest $request, RetryReason $reason): RequestBehaviour
     {
         if ($request->timeoutElapsed()) {
@@ -48,8 +53,22 @@ class RetryOrchestrator
         }
     }
 
+    /**
+     * @return array<string, int> number of retries performed by the process, keyed by retry reason
+     */
+    public static function retryCounters(): array
+    {
+        return self::$retryCounters;
+    }
+
     private static function retryWithDuration(ProtostellarRequest $request, RetryReason $reason, int $duration): RequestBehaviour
     {
+        if (!RetryBudget::tryAcquire()) {
+            return RequestBehaviour::fail(
+                new RequestCanceledException(message: "Retry budget of the process has been exhausted", context: $request->context())
+            );
+        }
+        self::$retryCounters[$reason->reason()] = (self::$retryCounters[$reason->reason()] ?? 0) + 1;
         $cappedDuration = self::capDuration($duration, $request);
         $request->incrementRetryAttempts($reason);
         return RequestBehaviour::retry($cappedDuration);
@@ -61,10 +80,8 @@ class RetryOrchestrator
         $absoluteTimeout = $request->absoluteTimeout();
         $timeoutDelta = $theoreticalTimeout - $absoluteTimeout;
         if ($timeoutDelta > 0) {
-            $cappedDuration = $uncappedDuration - $timeoutDelta;
-            if ($cappedDuration < 0) {
-                return $uncappedDuration;
-            }
+            // do not sleep past the deadline of the request
+            return (int)max(0, $uncappedDuration - $timeoutDelta);
         }
         return $uncappedDuration;
     }
@@ -414,6 +414,21 @@ class QueryOptions
         return $options->transcoder;
     }
 
+    /**
+     * @param QueryOptions|null $options
+     *
+     * @return bool false if the query has been explicitly marked as non-adhoc
+     * @internal
+     * @since 4.2.5
+     */
+    public static function isAdhoc(?QueryOptions $options): bool
+    {
+        if ($options == null) {
+            return true;
+        }
+        return $options->adHoc !== false;
+    }
+
     public static function export(?QueryOptions $options, ?string $scopeName = null, ?string $bucketName = null): array
     {
         $defaultQueryContext = null;
@@ -20,6 +20,8 @@ declare(strict_types=1);
 
 namespace Couchbase;
 
+use Couchbase\Exception\InvalidArgumentException;
+
 /**
  * A RangeScan performs a scan on a range of keys with the range specified through a start and end ScanTerm
  */
@@ -78,6 +80,90 @@ class RangeScan implements ScanType
         return $this;
     }
 
+    /**
+     * Splits the range into disjoint sub-ranges, that together cover the same keys, so that they can be scanned
+     * concurrently by independent workers (each using the same ScanOptions, including consistentWith()).
+     *
+     * The boundaries are placed on the first byte, where the start and the end terms differ, and are spread over
+     * printable ASCII characters, where the document keys are usually found. The method might return fewer ranges
+     * than requested, when the range is too narrow.
+     *
+     * The split only looks at the terms, not at the keys stored in the collection. When the range is open-ended,
+     * or its terms differ before the structured part of the keys (e.g. from "user::a" with no end), the boundaries
+     * land on the wrong byte and most of the keys might end up in one range. In such cases pass the prefix, that is
+     * shared by the keys of the range (e.g. "user::"), and the boundaries are placed on the byte right after it.
+     *
+     * @param int $count the desired number of ranges
+     * @param string|null $prefix the prefix shared by the keys of the range, or null to derive it from the terms
+     *
+     * @return array<RangeScan>
+     * @throws InvalidArgumentException
+     * @since 4.2.5
+     */
+    public function partition(int $count, ?string $prefix = null): array
+    {
+        if ($count < 1) {
+            throw new InvalidArgumentException("Number of partitions must be positive");
+        }
+        $lower = $this->from == null ? "" : ScanTerm::export($this->from)['term'];
+        $upper = $this->to == null ? null : ScanTerm::export($this->to)['term'];
+
+        if ($prefix === null) {
+            $prefixLength = 0;
+            if ($upper !== null) {
+                $limit = min(strlen($lower), strlen($upper));
+                while ($prefixLength < $limit && $lower[$prefixLength] == $upper[$prefixLength]) {
+                    ++$prefixLength;
+                }
+            }
+            $prefix = substr($lower, 0, $prefixLength);
+        } else {
+            $prefixLength = strlen($prefix);
+            if ((!str_starts_with($lower, $prefix) && strcmp($lower, $prefix) > 0) ||
+                ($upper !== null && !str_starts_with($upper, $prefix) && strcmp($upper, $prefix) < 0)) {
+                throw new InvalidArgumentException("The range does not contain keys with the partition prefix");
+            }
+        }
+        $first = 0x1f;
+        if (str_starts_with($lower, $prefix) && $prefixLength < strlen($lower)) {
+            $first = max(ord($lower[$prefixLength]), $first);
+        }
+        $last = 0x7f;
+        if ($upper !== null && str_starts_with($upper, $prefix)) {
+            $last = min($prefixLength < strlen($upper) ? ord($upper[$prefixLength]) : -1, $last);
+        }
+
+        $partitions = [];
+        $from = $this->from == null ? null : clone $this->from;
+        $previous = $first;
+        for ($i = 1; $i < $count; ++$i) {
+            $byte = $first + intdiv(($last - $first) * $i, $count);
+            if ($byte <= $previous || $byte >= $last) {
+                continue;
+            }
+            $boundary = $prefix . chr($byte);
+            $partitions[] = new RangeScan($from, new ScanTerm($boundary, true));
+            $from = new ScanTerm($boundary);
+            $previous = $byte;
+        }
+        $partitions[] = new RangeScan($from, $this->to == null ? null : clone $this->to);
+        return $partitions;
+    }
+
+    /**
+     * Returns the range, that continues the scan after the given key, for example to resume a failed worker from
+     * the last document it has processed.
+     *
+     * @param string $id the last processed key
+     *
+     * @return RangeScan
+     * @since 4.2.5
+     */
+    public function resumeAfter(string $id): RangeScan
+    {
+        return new RangeScan(new ScanTerm($id, true), $this->to == null ? null : clone $this->to);
+    }
+
     /**
      * @internal
      *
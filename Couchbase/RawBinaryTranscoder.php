@@ -23,6 +23,7 @@ namespace Couchbase;
 class RawBinaryTranscoder implements Transcoder
 {
     private static ?RawBinaryTranscoder $instance;
+    private static ?int $flags = null;
 
     public static function getInstance(): Transcoder
     {
@@ -42,9 +43,12 @@ class RawBinaryTranscoder implements Transcoder
      */
     public function encode($value): array
     {
+        if (self::$flags === null) {
+            self::$flags = (new TranscoderFlags(TranscoderFlags::DATA_FORMAT_BINARY))->encode();
+        }
         return [
             $value,
-            (new TranscoderFlags(TranscoderFlags::DATA_FORMAT_BINARY))->encode(),
+            self::$flags,
         ];
     }
 
@@ -25,6 +25,7 @@ use Couchbase\Exception\DecodingFailureException;
 class RawJsonTranscoder implements Transcoder
 {
     private static ?RawJsonTranscoder $instance;
+    private static ?int $flags = null;
 
     public static function getInstance(): Transcoder
     {
@@ -44,9 +45,12 @@ class RawJsonTranscoder implements Transcoder
      */
     public function encode($value): array
     {
+        if (self::$flags === null) {
+            self::$flags = (new TranscoderFlags(TranscoderFlags::DATA_FORMAT_JSON))->encode();
+        }
         return [
             $value,
-            (new TranscoderFlags(TranscoderFlags::DATA_FORMAT_JSON))->encode(),
+            self::$flags,
         ];
     }
 
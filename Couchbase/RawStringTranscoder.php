@@ -23,6 +23,7 @@ namespace Couchbase;
 class RawStringTranscoder implements Transcoder
 {
     private static ?RawStringTranscoder $instance;
+    private static ?int $flags = null;
 
     public static function getInstance(): Transcoder
     {
@@ -42,9 +43,12 @@ class RawStringTranscoder implements Transcoder
      */
     public function encode($value): array
     {
+        if (self::$flags === null) {
+            self::$flags = (new TranscoderFlags(TranscoderFlags::DATA_FORMAT_STRING))->encode();
+        }
         return [
             $value,
-            (new TranscoderFlags(TranscoderFlags::DATA_FORMAT_STRING))->encode(),
+            self::$flags,
         ];
     }
 
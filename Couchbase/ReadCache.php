@@ -0,0 +1,171 @@
+<?php
+
+/**
+ * Copyright 2014-Present Couchbase, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+declare(strict_types=1);
+
+namespace Couchbase;
+
+/**
+ * Bounded in-process cache of raw get responses, shared by all Cluster objects of the process that use the same
+ * connection and the same cache options.
+ *
+ * Entries are evicted in least recently used order, expire after configured TTL (or earlier, if the document
+ * expires sooner), and are invalidated by the key-value mutations performed by the process through Collection,
+ * BinaryCollection and transaction attempt contexts, including the Cluster objects without the read cache.
+ * Documents changed by N1QL statements (also inside transactions), through couchbase2:// clusters or by other
+ * processes stay cached until their TTL.
+ *
+ * @internal
+ *
+ * @since 4.2.5
+ */
+class ReadCache
+{
+    /**
+     * @var array<string, ReadCache> caches keyed by connection hash and exported options
+     */
+    private static array $instances = [];
+
+    private int $maxEntries;
+    private float $ttlSeconds;
+    /**
+     * @var array<string, array> maps key to tuple of expiration timestamp and the response
+     */
+    private array $entries = [];
+
+    /**
+     * @param string $connectionHash
+     * @param ReadCacheOptions $options
+     *
+     * @return ReadCache
+     * @internal
+     *
+     * @since 4.2.5
+     */
+    public static function forConnection(string $connectionHash, ReadCacheOptions $options): ReadCache
+    {
+        $instanceKey = sprintf("%s--%s", $connectionHash, serialize($options->export()));
+        if (!array_key_exists($instanceKey, self::$instances)) {
+            self::$instances[$instanceKey] = new ReadCache($options);
+        }
+        return self::$instances[$instanceKey];
+    }
+
+    /**
+     * @param ReadCacheOptions $options
+     *
+     * @internal
+     *
+     * @since 4.2.5
+     */
+    public function __construct(ReadCacheOptions $options)
+    {
+        $exported = $options->export();
+        $this->maxEntries = $exported['maxEntries'];
+        $this->ttlSeconds = $exported['ttl'] / 1000.0;
+    }
+
+    /**
+     * @param string $bucketName
+     * @param string $scopeName
+     * @param string $collectionName
+     * @param string $id
+     *
+     * @return string
+     * @internal
+     *
+     * @since 4.2.5
+     */
+    public static function key(string $bucketName, string $scopeName, string $collectionName, string $id): string
+    {
+        return sprintf("%s/%s/%s/%s", $bucketName, $scopeName, $collectionName, $id);
+    }
+
+    /**
+     * @param string $key
+     *
+     * @return array|null the cached response, or null if the entry is missing or expired
+     * @internal
+     *
+     * @since 4.2.5
+     */
+    public function get(string $key): ?array
+    {
+        if (!array_key_exists($key, $this->entries)) {
+            return null;
+        }
+        $entry = $this->entries[$key];
+        unset($this->entries[$key]);
+        if ($entry[0] < microtime(true)) {
+            return null;
+        }
+        // re-insert to move the entry to the tail of LRU order
+        $this->entries[$key] = $entry;
+        return $entry[1];
+    }
+
+    /**
+     * @param string $key
+     * @param array $response raw response of the get operation, fetched with expiry (other responses are not cached)
+     *
+     * @internal
+     *
+     * @since 4.2.5
+     */
+    public function put(string $key, array $response): void
+    {
+        // without the expiry of the document, the cache might serve it after it has expired
+        if (array_key_exists("error", $response) || !array_key_exists("expiry", $response)) {
+            return;
+        }
+        $now = microtime(true);
+        $expiresAt = $now + $this->ttlSeconds;
+        if ($response["expiry"] > 0) {
+            $expiresAt = min($expiresAt, (float)$response["expiry"]);
+        }
+        unset($this->entries[$key]);
+        $this->entries[$key] = [$expiresAt, $response];
+        while (count($this->entries) > $this->maxEntries) {
+            unset($this->entries[array_key_first($this->entries)]);
+        }
+    }
+
+    /**
+     * Drops the document from all caches of the process. Caches of different connections might drop the entry
+     * needlessly, when their clusters have collections with the same names, which only costs an extra fetch.
+     *
+     * @param string $bucketName
+     * @param string $scopeName
+     * @param string $collectionName
+     * @param string $id
+     *
+     * @internal
+     *
+     * @since 4.2.5
+     */
+    public static function invalidateDocument(string $bucketName, string $scopeName, string $collectionName, string $id): void
+    {
+        if (count(self::$instances) == 0) {
+            return;
+        }
+        $key = self::key($bucketName, $scopeName, $collectionName, $id);
+        foreach (self::$instances as $cache) {
+            unset($cache->entries[$key]);
+        }
+    }
+}
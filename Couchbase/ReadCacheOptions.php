@@ -0,0 +1,90 @@
+<?php
+
+/**
+ * Copyright 2014-Present Couchbase, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+declare(strict_types=1);
+
+namespace Couchbase;
+
+use Couchbase\Exception\InvalidArgumentException;
+
+class ReadCacheOptions
+{
+    private int $maxEntries = 1000;
+    private int $ttlMilliseconds = 1000;
+
+    /**
+     * Static helper to keep code more readable
+     *
+     * @return ReadCacheOptions
+     * @since 4.2.5
+     */
+    public static function build(): ReadCacheOptions
+    {
+        return new ReadCacheOptions();
+    }
+
+    /**
+     * Specifies the maximum number of documents kept in the cache. When the limit is reached, the least
+     * recently used document is evicted.
+     *
+     * @param int $numberOfEntries
+     *
+     * @return ReadCacheOptions
+     * @throws InvalidArgumentException
+     * @since 4.2.5
+     */
+    public function maxEntries(int $numberOfEntries): ReadCacheOptions
+    {
+        if ($numberOfEntries < 1) {
+            throw new InvalidArgumentException("Maximum number of entries must be positive");
+        }
+        $this->maxEntries = $numberOfEntries;
+        return $this;
+    }
+
+    /**
+     * Specifies how long the document is served from the cache after it has been fetched from the server.
+     *
+     * @param int $milliseconds
+     *
+     * @return ReadCacheOptions
+     * @throws InvalidArgumentException
+     * @since 4.2.5
+     */
+    public function ttl(int $milliseconds): ReadCacheOptions
+    {
+        if ($milliseconds < 1) {
+            throw new InvalidArgumentException("Time to live must be positive");
+        }
+        $this->ttlMilliseconds = $milliseconds;
+        return $this;
+    }
+
+    /**
+     * @internal
+     * @return array
+     * @since 4.2.5
+     */
+    public function export(): array
+    {
+        return [
+            'maxEntries' => $this->maxEntries,
+            'ttl' => $this->ttlMilliseconds,
+        ];
+    }
+}
@@ -20,12 +20,14 @@ declare(strict_types=1);
 
 namespace Couchbase;
 
+use Couchbase\Exception\InvalidArgumentException;
 use Couchbase\Utilities\Deprecations;
 
 class RemoveOptions
 {
     private ?int $timeoutMilliseconds = null;
     private ?string $durabilityLevel = null;
+    private ?int $maxInFlight = null;
     private ?string $cas = null;
 
     /**
@@ -87,6 +89,40 @@ class RemoveOptions
         return $this;
     }
 
+    /**
+     * Sets the maximum number of operations of removeMulti() that are sent at once.
+     *
+     * @param int $limit the size of the window, which shrinks on timeouts and grows back after
+     *
+     * @return RemoveOptions
+     * @throws InvalidArgumentException
+     * @since 4.2.5
+     */
+    public function maxInFlight(int $limit): RemoveOptions
+    {
+        if ($limit < 1) {
+            throw new InvalidArgumentException("Maximum number of operations in flight must be positive");
+        }
+        $this->maxInFlight = $limit;
+        return $this;
+    }
+
+    /**
+     * @internal
+     *
+     * @param RemoveOptions|null $options
+     *
+     * @return int|null
+     * @since 4.2.5
+     */
+    public static function getMaxInFlight(?RemoveOptions $options): ?int
+    {
+        if ($options == null) {
+            return null;
+        }
+        return $options->maxInFlight;
+    }
+
     /**
      * @internal
      *
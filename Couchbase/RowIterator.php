@@ -0,0 +1,80 @@
+<?php
+
+/**
+ * Copyright 2014-Present Couchbase, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+declare(strict_types=1);
+
+namespace Couchbase;
+
+use ArrayIterator;
+use Traversable;
+
+/**
+ * Helper for the results of the queries, that decode their rows lazily.
+ *
+ * @internal
+ * @since 4.2.5
+ */
+class RowIterator
+{
+    /**
+     * Returns the iterator over the rows, which have already been decoded, or otherwise the iterator which decodes
+     * the encoded rows one at a time, as they are consumed.
+     *
+     * @param array|null $rows decoded rows, or null if they have not been decoded yet
+     * @param array $encodedRows rows as they came from the server
+     * @param callable $decodeRow function that decodes single row
+     *
+     * @return Traversable
+     * @internal
+     * @since 4.2.5
+     */
+    public static function create(?array $rows, array $encodedRows, callable $decodeRow): Traversable
+    {
+        if ($rows !== null) {
+            return new ArrayIterator($rows);
+        }
+        return (function () use ($encodedRows, $decodeRow) {
+            foreach ($encodedRows as $row) {
+                yield $decodeRow($row);
+            }
+        })();
+    }
+
+    /**
+     * Decodes all rows at once. The default JSON transcoder decodes them with single call, while any other
+     * transcoder, including subclasses of the default one that might override decode(), is called for each row.
+     *
+     * @param array $encodedRows rows as they came from the server
+     * @param Transcoder $transcoder
+     *
+     * @return array
+     * @internal
+     * @since 4.2.5
+     */
+    public static function decodeAll(array $encodedRows, Transcoder $transcoder): array
+    {
+        if (get_class($transcoder) === JsonTranscoder::class) {
+            return $transcoder->decodeMany($encodedRows, 0);
+        }
+        $rows = [];
+        foreach ($encodedRows as $row) {
+            $rows[] = $transcoder->decode($row, 0);
+        }
+        return $rows;
+    }
+}
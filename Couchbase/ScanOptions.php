@@ -31,6 +31,7 @@ class ScanOptions
     private ?int $batchByteLimit = null;
     private ?int $batchItemLimit = null;
     private ?int $concurrency = null;
+    private bool $rawItems = false;
 
     /**
      * @since 4.1.6
@@ -155,6 +156,42 @@ class ScanOptions
         return $this;
     }
 
+    /**
+     * Sets whether the iterator of the scan results should yield raw tuples
+     * [id, value, flags, cas] instead of ScanResult objects.
+     *
+     * The value is the encoded document content (null if only ids requested), so the
+     * transcoder is not involved. This saves allocation of the result object for every
+     * item when exporting large number of documents.
+     *
+     * @param bool $rawItems
+     *
+     * @return ScanOptions
+     * @since 4.2.5
+     */
+    public function rawItems(bool $rawItems): ScanOptions
+    {
+        $this->rawItems = $rawItems;
+        return $this;
+    }
+
+    /**
+     * Returns whether the scan should yield raw tuples instead of ScanResult objects.
+     *
+     * @param ScanOptions|null $options
+     *
+     * @return bool
+     * @internal
+     * @since 4.2.5
+     */
+    public static function getRawItems(?ScanOptions $options): bool
+    {
+        if ($options == null) {
+            return false;
+        }
+        return $options->rawItems;
+    }
+
     /**
      * Returns associated transcoder.
      *
@@ -20,6 +20,7 @@ declare(strict_types=1);
 
 namespace Couchbase;
 
+use Couchbase\Exception\InvalidArgumentException;
 use IteratorAggregate;
 use Traversable;
 
@@ -33,6 +34,7 @@ class ScanResults implements IteratorAggregate
      */
     private $coreScanResult;
     private Transcoder $transcoder;
+    private bool $rawItems;
 
     /**
      * @param $core
@@ -42,12 +44,13 @@ class ScanResults implements IteratorAggregate
      * @param array $type
      * @param array $options
      * @param Transcoder $transcoder
+     * @param bool $rawItems
      *
      * @internal
      *
      * @since 4.1.6
      */
-    public function __construct($core, string $bucketName, string $scopeName, string $collectionName, array $type, array $options, Transcoder $transcoder)
+    public function __construct($core, string $bucketName, string $scopeName, string $collectionName, array $type, array $options, Transcoder $transcoder, bool $rawItems = false)
     {
         $this->coreScanResult = Extension\createDocumentScanResult(
             $core,
@@ -58,11 +61,14 @@ class ScanResults implements IteratorAggregate
             $options
         );
         $this->transcoder = $transcoder;
+        $this->rawItems = $rawItems;
     }
 
     /**
      * Returns the iterator which streams through the ScanResults
      *
+     * If ScanOptions::rawItems() was set, the iterator yields tuples [id, value, flags, cas] instead.
+     *
      * @return Traversable
      *
      * @since 4.1.6
@@ -72,9 +78,60 @@ class ScanResults implements IteratorAggregate
         return (function () {
             $res = Extension\documentScanNextItem($this->coreScanResult);
             while (!is_null($res)) {
-                yield new ScanResult($res, $this->transcoder);
+                yield $this->convertItem($res);
                 $res = Extension\documentScanNextItem($this->coreScanResult);
             }
         })();
     }
+
+    /**
+     * Returns the iterator which streams through the ScanResults grouped into pages of the given size.
+     * The last page might contain fewer items.
+     *
+     * @param int $pageSize maximum number of items in the page
+     *
+     * @return Traversable iterator over arrays of ScanResult (or raw tuples, see ScanOptions::rawItems())
+     * @throws InvalidArgumentException
+     *
+     * @since 4.2.5
+     */
+    public function pages(int $pageSize): Traversable
+    {
+        if ($pageSize < 1) {
+            throw new InvalidArgumentException("Page size must be positive");
+        }
+        return (function () use ($pageSize) {
+            $page = [];
+            $res = Extension\documentScanNextItem($this->coreScanResult);
+            while (!is_null($res)) {
+                $page[] = $this->convertItem($res);
+                if (count($page) == $pageSize) {
+                    yield $page;
+                    $page = [];
+                }
+                $res = Extension\documentScanNextItem($this->coreScanResult);
+            }
+            if (count($page) > 0) {
+                yield $page;
+            }
+        })();
+    }
+
+    /**
+     * @param array $item
+     *
+     * @return ScanResult|array
+     */
+    private function convertItem(array $item)
+    {
+        if (!$this->rawItems) {
+            return new ScanResult($item, $this->transcoder);
+        }
+        return [
+            $item['id'],
+            $item['value'] ?? null,
+            $item['flags'] ?? null,
+            $item['cas'] ?? null,
+        ];
+    }
 }
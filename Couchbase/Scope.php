@@ -37,21 +37,37 @@ class Scope implements ScopeInterface
      * @var resource
      */
     private $core;
+    private ?ReadCache $readCache;
+    private ?PreparedStatementCache $preparedStatements;
+    private bool $preparedStatementCache;
 
     /**
      * @param string $name
      * @param string $bucketName
      * @param resource $core
+     * @param ReadCache|null $readCache
+     * @param PreparedStatementCache|null $preparedStatements
+     * @param bool $preparedStatementCache whether non-adhoc queries always go through the prepared statement cache
      *
      * @internal
      *
      * @since 4.0.0
      */
-    public function __construct(string $name, string $bucketName, $core)
+    public function __construct(
+        string $name,
+        string $bucketName,
+        $core,
+        ?ReadCache $readCache = null,
+        ?PreparedStatementCache $preparedStatements = null,
+        bool $preparedStatementCache = false
+    )
     {
         $this->name = $name;
         $this->bucketName = $bucketName;
         $this->core = $core;
+        $this->readCache = $readCache;
+        $this->preparedStatements = $preparedStatements;
+        $this->preparedStatementCache = $preparedStatementCache;
     }
 
     /**
@@ -75,7 +91,7 @@ class Scope implements ScopeInterface
      */
     public function collection(string $name): CollectionInterface
     {
-        return new Collection($name, $this->name, $this->bucketName, $this->core);
+        return new Collection($name, $this->name, $this->bucketName, $this->core, $this->readCache);
     }
 
     /**
@@ -91,7 +107,16 @@ class Scope implements ScopeInterface
      */
     public function query(string $statement, ?QueryOptions $options = null): QueryResult
     {
-        $result = Extension\query($this->core, $statement, QueryOptions::export($options, $this->name, $this->bucketName));
+        $exported = QueryOptions::export($options, $this->name, $this->bucketName);
+        if (
+            $this->preparedStatements != null &&
+            !QueryOptions::isAdhoc($options) &&
+            ($this->preparedStatementCache || $this->preparedStatements->contains($statement, $exported['queryContext']))
+        ) {
+            $result = $this->preparedStatements->execute($this->core, $statement, $exported);
+        } else {
+            $result = Extension\query($this->core, $statement, $exported);
+        }
 
         return new QueryResult($result, QueryOptions::getTranscoder($options));
     }
@@ -20,13 +20,17 @@ declare(strict_types=1);
 
 namespace Couchbase;
 
+use IteratorAggregate;
+use Traversable;
+
 /**
  * Class for retrieving results from search queries.
  */
-class SearchResult
+class SearchResult implements IteratorAggregate
 {
     private ?SearchMetaData $metadata = null;
     private ?array $facets = null;
+    private array $encodedRows;
     private ?array $rows = null;
 
     /**
@@ -37,18 +41,7 @@ class SearchResult
     public function __construct(array $result)
     {
         $this->metadata = new SearchMetaData($result['meta']);
-        $this->rows = [];
-        foreach ($result['rows'] as $row) {
-            $this->rows[] = [
-                'id' => $row['id'],
-                'index' => $row['index'],
-                'score' => $row['score'],
-                'explanation' => (array)json_decode($row['explanation']),
-                'locations' => $row['locations'],
-                'fragments' => $row['fragments'],
-                'fields' => (array)json_decode($row['fields']),
-            ];
-        }
+        $this->encodedRows = $result['rows'];
         $this->facets = [];
         foreach ($result['facets'] as $facet) {
             $this->facets[$facet['name']] = new SearchFacetResult($facet);
@@ -83,6 +76,39 @@ class SearchResult
      */
     public function rows(): ?array
     {
+        if ($this->rows === null) {
+            $this->rows = [];
+            foreach ($this->encodedRows as $row) {
+                $this->rows[] = self::decodeRow($row);
+            }
+            $this->encodedRows = [];
+        }
         return $this->rows;
     }
+
+    /**
+     * Returns the iterator which decodes the rows one at a time, as they are consumed
+     *
+     * @return Traversable
+     * @since 4.2.5
+     */
+    public function getIterator(): Traversable
+    {
+        return RowIterator::create($this->rows, $this->encodedRows, function (array $row) {
+            return self::decodeRow($row);
+        });
+    }
+
+    private static function decodeRow(array $row): array
+    {
+        return [
+            'id' => $row['id'],
+            'index' => $row['index'],
+            'score' => $row['score'],
+            'explanation' => (array)json_decode($row['explanation']),
+            'locations' => $row['locations'],
+            'fragments' => $row['fragments'],
+            'fields' => (array)json_decode($row['fields']),
+        ];
+    }
 }
@@ -29,6 +29,10 @@ class TransactionAttemptContext
      * @var resource
      */
     private $transaction;
+    /**
+     * @var array<array> bucket, scope, collection and key of the documents staged by this attempt
+     */
+    private array $mutatedDocuments = [];
 
     /**
      * @param resource $transaction
@@ -74,6 +78,7 @@ class TransactionAttemptContext
      */
     public function insert(Collection $collection, string $id, $value): TransactionGetResult
     {
+        $this->mutatedDocuments[] = [$collection->bucketName(), $collection->scopeName(), $collection->name(), $id];
         $encoded = InsertOptions::encodeDocument(null, $value);
         $response = Extension\transactionInsert(
             $this->transaction,
@@ -98,6 +103,7 @@ class TransactionAttemptContext
      */
     public function replace(TransactionGetResult $document, $value): TransactionGetResult
     {
+        $this->rememberMutation($document);
         $encoded = ReplaceOptions::encodeDocument(null, $value);
         $response = Extension\transactionReplace(
             $this->transaction,
@@ -118,6 +124,7 @@ class TransactionAttemptContext
      */
     public function remove(TransactionGetResult $document)
     {
+        $this->rememberMutation($document);
         Extension\transactionRemove(
             $this->transaction,
             $document->export(),
@@ -139,4 +146,29 @@ class TransactionAttemptContext
 
         return new QueryResult($result, TransactionQueryOptions::getTranscoder($options));
     }
+
+    /**
+     * Drops the documents staged by this attempt from the read caches of the process, once the transaction
+     * has been committed.
+     *
+     * @internal
+     * @since 4.2.5
+     */
+    public function invalidateReadCache(): void
+    {
+        foreach ($this->mutatedDocuments as $document) {
+            ReadCache::invalidateDocument(...$document);
+        }
+    }
+
+    private function rememberMutation(TransactionGetResult $document): void
+    {
+        $exported = $document->export();
+        $this->mutatedDocuments[] = [
+            $exported['bucketName'],
+            $exported['scopeName'],
+            $exported['collectionName'],
+            $exported['id'],
+        ];
+    }
 }
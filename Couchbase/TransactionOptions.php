@@ -20,6 +20,8 @@ declare(strict_types=1);
 
 namespace Couchbase;
 
+use Couchbase\Exception\InvalidArgumentException;
+use Couchbase\Utilities\Backoff;
 use Couchbase\Utilities\Deprecations;
 
 class TransactionOptions
@@ -27,6 +29,8 @@ class TransactionOptions
     private ?string $durabilityLevel = null;
     private ?int $timeoutMilliseconds = null;
     private ?int $keyValueTimeoutMilliseconds = null;
+    private int $retryBackoffInitialMilliseconds = 1;
+    private int $retryBackoffMaxMilliseconds = 100;
 
     /**
      * Specifies the timeout for the transaction.
@@ -76,6 +80,51 @@ class TransactionOptions
         return $this;
     }
 
+    /**
+     * Specifies the delay between attempts of the transaction. The delay starts at the initial value and doubles with
+     * every attempt up to the maximum, with random jitter applied. Zero values disable the delay.
+     *
+     * @param int $initialMilliseconds delay before the second attempt
+     * @param int $maxMilliseconds upper bound for the delay
+     *
+     * @return TransactionOptions
+     * @throws InvalidArgumentException
+     * @since 4.2.5
+     */
+    public function retryBackoff(int $initialMilliseconds, int $maxMilliseconds): TransactionOptions
+    {
+        if ($initialMilliseconds < 0 || $maxMilliseconds < $initialMilliseconds) {
+            throw new InvalidArgumentException("Retry backoff must not be negative, and the maximum must not be below the initial delay");
+        }
+        $this->retryBackoffInitialMilliseconds = $initialMilliseconds;
+        $this->retryBackoffMaxMilliseconds = $maxMilliseconds;
+        return $this;
+    }
+
+    /**
+     * @param TransactionOptions|null $options
+     * @param int $attempt number of the attempt that has just failed, starting from 1
+     *
+     * @return int delay in microseconds before the next attempt
+     * @internal
+     * @since 4.2.5
+     */
+    public static function retryDelay(?TransactionOptions $options, int $attempt): int
+    {
+        if ($options == null) {
+            $options = new TransactionOptions();
+        }
+        if ($options->retryBackoffMaxMilliseconds == 0) {
+            return 0;
+        }
+        return Backoff::delay(
+            $options->retryBackoffInitialMilliseconds * 1000,
+            $options->retryBackoffMaxMilliseconds * 1000,
+            $attempt - 1,
+            true
+        );
+    }
+
     /**
      * @param TransactionOptions|null $options
      *
@@ -57,10 +57,19 @@ class Transactions
     {
         $transaction = new TransactionAttemptContextDetails($this->transactions, $options);
 
+        $attempt = 0;
         while (true) {
+            if ($attempt > 0) {
+                $delay = TransactionOptions::retryDelay($options, $attempt);
+                if ($delay > 0) {
+                    usleep($delay);
+                }
+            }
+            ++$attempt;
             $transaction->newAttempt();
+            $context = $transaction->transactionAttemptContext();
             try {
-                $logic($transaction->transactionAttemptContext());
+                $logic($context);
             } catch (Exception $exception) {
                 $transaction->rollback();
                 throw new TransactionFailedException("Exception caught during execution of transaction logic. " . $exception->getMessage(), 0, $exception);
@@ -76,6 +85,9 @@ class Transactions
                 return $result;
             } catch (Exception $exception) {
                 // commit failed, retry...
+            } finally {
+                // even failed commit might have made some of the staged documents visible
+                $context->invalidateReadCache();
             }
         }
     }
@@ -20,6 +20,7 @@ declare(strict_types=1);
 
 namespace Couchbase;
 
+use Couchbase\Exception\InvalidArgumentException;
 use Couchbase\Utilities\Deprecations;
 use DateTimeInterface;
 
@@ -31,6 +32,7 @@ class UpsertOptions
     private ?int $expiryTimestamp = null;
     private ?bool $preserveExpiry = null;
     private ?string $durabilityLevel = null;
+    private ?int $maxInFlight = null;
 
     /**
      * @since 4.0.0
@@ -150,6 +152,40 @@ class UpsertOptions
         return $options->transcoder->encode($document);
     }
 
+    /**
+     * Sets the maximum number of operations of upsertMulti() that are sent at once.
+     *
+     * @param int $limit the size of the window, which shrinks on timeouts and grows back after
+     *
+     * @return UpsertOptions
+     * @throws InvalidArgumentException
+     * @since 4.2.5
+     */
+    public function maxInFlight(int $limit): UpsertOptions
+    {
+        if ($limit < 1) {
+            throw new InvalidArgumentException("Maximum number of operations in flight must be positive");
+        }
+        $this->maxInFlight = $limit;
+        return $this;
+    }
+
+    /**
+     * @internal
+     *
+     * @param UpsertOptions|null $options
+     *
+     * @return int|null
+     * @since 4.2.5
+     */
+    public static function getMaxInFlight(?UpsertOptions $options): ?int
+    {
+        if ($options == null) {
+            return null;
+        }
+        return $options->maxInFlight;
+    }
+
     /**
      * @internal
      *
@@ -0,0 +1,53 @@
+<?php
+
+/**
+ * Copyright 2014-Present Couchbase, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+declare(strict_types=1);
+
+namespace Couchbase\Utilities;
+
+/**
+ * Capped exponential backoff shared by the components of the SDK, that retry operations themselves.
+ *
+ * @internal
+ * @since 4.2.5
+ */
+class Backoff
+{
+    /**
+     * Returns the delay before the given retry. The delay starts at the initial value and doubles with every retry
+     * up to the maximum. With jitter, the delay is randomized within its upper half, so that operations failed at
+     * the same time are not retried at the same time.
+     *
+     * @param int $initialDelay the delay before the first retry
+     * @param int $maxDelay upper bound for the delay, in the same units
+     * @param int $retry number of the retry, starting from 0
+     * @param bool $jitter whether to randomize the delay
+     *
+     * @return int delay in the same units as the arguments
+     * @internal
+     * @since 4.2.5
+     */
+    public static function delay(int $initialDelay, int $maxDelay, int $retry, bool $jitter): int
+    {
+        $delay = min($maxDelay, $initialDelay * (2 ** min(max($retry, 0), 30)));
+        if ($jitter) {
+            $delay = $delay / 2 + mt_rand(0, 1000) * $delay / 2000;
+        }
+        return (int)$delay;
+    }
+}
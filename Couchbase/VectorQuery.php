@@ -76,6 +76,49 @@ class VectorQuery
         return new VectorQuery($vectorFieldName, $vectorQuery);
     }
 
+    /**
+     * Creates vector query from the binary string of packed little-endian IEEE 754 floats, as produced by
+     * pack('g*', ...$vector). The vector is sent as base64 string, which is much shorter and cheaper to
+     * produce and parse than the JSON array of decimal numbers.
+     *
+     * @param string $vectorFieldName the document field that contains the vector
+     * @param string $packedVector the packed float32 vector. Cannot be empty.
+     *
+     * @return VectorQuery
+     * @throws InvalidArgumentException
+     * @since 4.2.5
+     *
+     * @UNCOMMITTED: This API may change in the future.
+     */
+    public static function fromFloat32(string $vectorFieldName, string $packedVector): VectorQuery
+    {
+        if (strlen($packedVector) % 4 != 0) {
+            throw new InvalidArgumentException("The length of packed float32 vector must be a multiple of 4 bytes");
+        }
+        return new VectorQuery($vectorFieldName, base64_encode($packedVector));
+    }
+
+    /**
+     * Creates vector query, that sends the vector as base64-encoded float32 values instead of JSON array. Note
+     * that the components are rounded to single precision.
+     *
+     * @param string $vectorFieldName the document field that contains the vector
+     * @param array<float> $vector the vector query to run. Cannot be empty.
+     *
+     * @return VectorQuery
+     * @throws InvalidArgumentException
+     * @since 4.2.5
+     *
+     * @UNCOMMITTED: This API may change in the future.
+     */
+    public static function packed(string $vectorFieldName, array $vector): VectorQuery
+    {
+        if (empty($vector)) {
+            throw new InvalidArgumentException("The vectorQuery cannot be empty");
+        }
+        return self::fromFloat32($vectorFieldName, pack('g*', ...$vector));
+    }
+
     /**
      * Sets the number of results that will be returned from this vector query. Defaults to 3.
      *
@@ -132,11 +175,7 @@ class VectorQuery
         }
 
         if ($query->vectorQuery != null) {
-            $vectorQueries = [];
-            foreach ($query->vectorQuery as $value) {
-                $vectorQueries[] = $value;
-            }
-            $json['vector'] = $vectorQueries;
+            $json['vector'] = array_values($query->vectorQuery);
         } else {
             $json['vector_base64'] = $query->base64VectorQuery;
         }
@@ -20,13 +20,17 @@ declare(strict_types=1);
 
 namespace Couchbase;
 
+use IteratorAggregate;
+use Traversable;
+
 /**
  * Class for retrieving results from view queries.
  */
-class ViewResult
+class ViewResult implements IteratorAggregate
 {
     private ViewMetaData $meta;
-    private array $rows;
+    private array $encodedRows;
+    private ?array $rows = null;
 
     public function __construct(array $result)
     {
@@ -35,10 +39,7 @@ class ViewResult
             $meta = $result["meta"];
         }
         $this->meta = new ViewMetaData($meta);
-        $this->rows = [];
-        foreach ($result["rows"] as $resultRow) {
-            $this->rows[] = new ViewRow($resultRow);
-        }
+        $this->encodedRows = $result["rows"];
     }
 
     /**
@@ -58,6 +59,26 @@ class ViewResult
      */
     public function rows(): ?array
     {
+        if ($this->rows === null) {
+            $this->rows = [];
+            foreach ($this->encodedRows as $resultRow) {
+                $this->rows[] = new ViewRow($resultRow);
+            }
+            $this->encodedRows = [];
+        }
         return $this->rows;
     }
+
+    /**
+     * Returns the iterator which creates the rows one at a time, as they are consumed
+     *
+     * @return Traversable
+     * @since 4.2.5
+     */
+    public function getIterator(): Traversable
+    {
+        return RowIterator::create($this->rows, $this->encodedRows, function (array $resultRow) {
+            return new ViewRow($resultRow);
+        });
+    }
 }